@@ -0,0 +1,353 @@
+// vex_bench.cpp
+//
+// Microbenchmarks for the engine's per-frame and load-time hot paths:
+//   - the collision broadphase (CollisionGrid query vs. a linear scan over every box)
+//   - Player::update, i.e. input, gravity and move() against the level's grid,
+//     for levels from 10^2 to 10^6 tiles
+//   - SentinelInteraction::handleOrbs with 10 to 100k live orbs
+//   - buildLevel on generated text and binary levels
+//   - Background vertex building
+//
+// Everything runs headless (no window, no GL, no keyboard). Results go to stdout
+// as one JSON document with ns/op and heap allocations/op per benchmark, so runs
+// can be diffed or checked by a script. Run from the repository root: the assets
+// and levels/level3.txt are loaded from there.
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/AssetLoader.hpp"
+#include "../include/AssetType.hpp"
+#include "../include/Background.hpp"
+#include "../include/CollisionGrid.hpp"
+#include "../include/Enemy.hpp"
+#include "../include/Input.hpp"
+#include "../include/LevelIO.hpp"
+#include "../include/LevelStreamer.hpp"
+#include "../include/Player.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/SentinelInteraction.hpp"
+#include "../include/TextureAtlas.hpp"
+
+// Every heap allocation in the process goes through here so each benchmark can
+// report how many its operation makes.
+namespace {
+std::atomic<std::size_t> allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+
+const float TILE_SIZE = 64.0f;
+const int LEVEL_WIDTH_IN_TILES = 400;
+const float STEP_TIME = 1.0f / 120.0f;
+const sf::Vector2u WINDOW_SIZE(1920, 1080);
+
+struct Result {
+    std::string name;
+    long long size;
+    long long operations;
+    double nsPerOp;
+    double allocsPerOp;
+};
+
+std::vector<Result> results;
+
+// Runs batches x opsPerBatch calls of op(i). reset() runs before each batch,
+// outside the timed and counted section, for benchmarks whose operation uses
+// up its input (orbs leaving the view).
+template <typename Reset, typename Op>
+void measure(const std::string& name, long long size, int batches, int opsPerBatch, Reset&& reset, Op&& op) {
+    reset();
+    op(0);  // warm-up: first-touch page faults and lazily grown buffers
+
+    double totalNs = 0.0;
+    std::size_t totalAllocations = 0;
+    int i = 0;
+    for (int batch = 0; batch < batches; ++batch) {
+        reset();
+        std::size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        for (int batchOp = 0; batchOp < opsPerBatch; ++batchOp) {
+            op(i++);
+        }
+        auto end = std::chrono::steady_clock::now();
+        totalAllocations += allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+        totalNs += std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    long long operations = static_cast<long long>(batches) * opsPerBatch;
+    results.push_back({name, size, operations, totalNs / operations, static_cast<double>(totalAllocations) / operations});
+    std::cerr << name << " [" << size << "]: " << totalNs / operations << " ns/op" << std::endl;
+}
+
+template <typename Op>
+void measure(const std::string& name, long long size, int iterations, Op&& op) {
+    measure(name, size, 1, iterations, [] {}, std::forward<Op>(op));
+}
+
+// Keeps iterations x size roughly constant so every size takes about as long.
+int scaledIterations(long long work, long long size, int minimum) {
+    return static_cast<int>(std::max<long long>(minimum, work / std::max<long long>(size, 1)));
+}
+
+// Rows of solid tiles with every third cell left open, like a stack of platforms.
+std::vector<sf::FloatRect> makeLevel(int tileCount) {
+    std::vector<sf::FloatRect> boxes;
+    boxes.reserve(tileCount);
+    for (int cell = 0; static_cast<int>(boxes.size()) < tileCount; ++cell) {
+        int column = cell % LEVEL_WIDTH_IN_TILES;
+        int row = cell / LEVEL_WIDTH_IN_TILES;
+        if (column % 3 == 2) continue;
+        boxes.emplace_back(column * TILE_SIZE, row * TILE_SIZE * 2.0f, TILE_SIZE, TILE_SIZE);
+    }
+    return boxes;
+}
+
+// The same layout as a tile list, for the level files
+std::vector<std::pair<sf::Vector2f, AssetType>> makeLevelTiles(int tileCount) {
+    std::vector<std::pair<sf::Vector2f, AssetType>> tiles;
+    tiles.reserve(tileCount);
+    for (const sf::FloatRect& box : makeLevel(tileCount)) {
+        tiles.emplace_back(sf::Vector2f(box.left, box.top), AssetType::Brick);
+    }
+    return tiles;
+}
+
+// Player-sized query rect wandering over the level so every query touches different cells.
+sf::FloatRect playerBoundsAt(int step, int tileCount) {
+    int rows = tileCount / LEVEL_WIDTH_IN_TILES + 1;
+    float x = static_cast<float>((step * 37) % (LEVEL_WIDTH_IN_TILES * 64));
+    float y = static_cast<float>((step * 11) % (rows * 128 + 1));
+    return sf::FloatRect(x, y, 64.0f, 64.0f);
+}
+
+bool loadAtlas(TextureAtlas& atlas) {
+    AssetLoader assetLoader;
+    for (const AssetInfo& info : ASSET_INFO) {
+        assetLoader.addImage(info.texturePath);
+    }
+    assetLoader.run();
+
+    std::vector<std::pair<AssetType, const sf::Image*>> atlasImages;
+    for (const AssetInfo& info : ASSET_INFO) {
+        const sf::Image* image = assetLoader.getImage(info.texturePath);
+        if (!image) return false;
+        atlasImages.emplace_back(info.type, image);
+    }
+    return atlas.loadFromImages(atlasImages, false);
+}
+
+void benchCollisionQuery() {
+    const int tileCounts[] = {100, 1000, 10000, 100000};
+    volatile int sink = 0;
+
+    for (int tileCount : tileCounts) {
+        std::vector<sf::FloatRect> boxes = makeLevel(tileCount);
+        CollisionGrid grid;
+        grid.build(boxes);
+
+        measure("collision_grid_query", tileCount, 200000, [&](int step) {
+            sf::FloatRect player = playerBoundsAt(step, tileCount);
+            int hits = 0;
+            grid.query(player, [&](const sf::FloatRect& box) {
+                if (player.intersects(box)) ++hits;
+            });
+            sink = sink + hits;
+        });
+
+        measure("collision_linear_scan", tileCount, scaledIterations(20000000, tileCount, 20), [&](int step) {
+            sf::FloatRect player = playerBoundsAt(step, tileCount);
+            int hits = 0;
+            for (const auto& box : boxes) {
+                if (player.intersects(box)) ++hits;
+            }
+            sink = sink + hits;
+        });
+    }
+}
+
+// One simulation step of the player (input, gravity, move() and its grid
+// collision) dropped at a different spot of the level each time
+void benchPlayerUpdate() {
+    const int tileCounts[] = {100, 1000, 10000, 100000, 1000000};
+
+    for (int tileCount : tileCounts) {
+        CollisionGrid grid;
+        grid.build(CollisionGrid::mergeBoxes(makeLevel(tileCount)));
+
+        int rows = tileCount / LEVEL_WIDTH_IN_TILES + 1;
+        sf::FloatRect worldBounds(0.0f, 0.0f, LEVEL_WIDTH_IN_TILES * TILE_SIZE, rows * TILE_SIZE * 2.0f + 1080.0f);
+
+        Player player(0.0f, 0.0f);
+        Enemy enemy(-10000.0f, -10000.0f);
+
+        measure("player_update", tileCount, 200000, [&](int step) {
+            sf::FloatRect start = playerBoundsAt(step, tileCount);
+            player.setPosition(start.left, start.top);
+            player.update(STEP_TIME, grid, worldBounds, enemy);
+        });
+    }
+}
+
+// Orbs of every pattern spread over the view of level 3, stepped a few times
+// per batch and put back before the next one
+void benchOrbs(const LoadedLevel& level) {
+    const int orbCounts[] = {10, 100, 1000, 10000, 100000};
+    const int STEPS_PER_BATCH = 8;
+
+    sf::View view(sf::FloatRect(0.0f, 0.0f, 1920.0f, 1080.0f));
+    std::unique_ptr<Player> player = std::make_unique<Player>(960.0f, 900.0f);
+    std::unique_ptr<Enemy> enemy = std::make_unique<Enemy>(960.0f, 100.0f);
+    SentinelInteraction sentinel(view, player, enemy);
+    sentinel.setCurrentSolidity(level.solidity);
+
+    for (int orbCount : orbCounts) {
+        OrbPool initial(sentinel.getOrbs().getRadius());
+        initial.reserve(orbCount);
+        for (int orb = 0; orb < orbCount; ++orb) {
+            float x = 200.0f + static_cast<float>((orb * 53) % 1500);
+            float y = 100.0f + static_cast<float>((orb * 29) % 500);
+            initial.spawn(x, y, static_cast<float>((orb * 7) % 360), static_cast<std::uint8_t>(orb % 4));
+        }
+
+        int batches = scaledIterations(4000000, orbCount, 20) / STEPS_PER_BATCH + 1;
+        measure(
+            "orbs_handle", orbCount, batches, STEPS_PER_BATCH,
+            [&] { sentinel.getOrbs() = initial; },
+            [&](int) { sentinel.handleOrbs(STEP_TIME, player->getPosition()); });
+    }
+}
+
+// buildLevel (parse or map, merge collision boxes, tile map, grid, solidity)
+// on generated levels written to the temp directory in both formats
+void benchLevelLoad(const TextureAtlas& atlas) {
+    namespace fs = std::filesystem;
+    const int tileCounts[] = {1000, 10000, 100000, 1000000};
+
+    std::vector<sf::Vector2f> assetSizes(ASSET_TYPE_COUNT + 1);
+    for (const AssetInfo& info : ASSET_INFO) {
+        if (atlas.contains(info.type)) assetSizes[static_cast<std::size_t>(info.type)] = atlas.getSize(info.type);
+    }
+
+    for (int tileCount : tileCounts) {
+        fs::path directory = fs::temp_directory_path();
+        std::string textPath = (directory / ("vex_bench_" + std::to_string(tileCount) + ".txt")).string();
+        std::string binaryPath = (directory / ("vex_bench_" + std::to_string(tileCount) + "_binary.vexl")).string();
+
+        LevelData data;
+        data.tiles = makeLevelTiles(tileCount);
+        data.collisionBoxes = buildCollisionBoxes(data.tiles, assetSizes);
+        if (!saveLevelText(textPath, data.tiles) || !saveLevelBinary(binaryPath, data)) {
+            std::cerr << "Failed to write benchmark levels to " << directory << std::endl;
+            return;
+        }
+
+        int iterations = scaledIterations(3000000, tileCount, 3);
+        measure("level_build_text", tileCount, iterations, [&](int) {
+            LoadedLevel level;
+            buildLevel(textPath, atlas, level);
+        });
+        measure("level_build_binary", tileCount, iterations, [&](int) {
+            LoadedLevel level;
+            buildLevel(binaryPath, atlas, level);
+        });
+
+        std::error_code error;
+        fs::remove(textPath, error);
+        fs::remove(binaryPath, error);
+    }
+}
+
+bool benchBackground() {
+    const std::string layerPaths[] = {"assets/tutorial_level/background.png",
+                                      "assets/tutorial_level/middleground.png",
+                                      "assets/tutorial_level/mountains.png"};
+
+    // The textures are empty with graphics disabled, so take the layer sizes
+    // from the decoded images; otherwise the vertex math runs on NaNs
+    AssetLoader assetLoader;
+    for (const std::string& path : layerPaths) {
+        assetLoader.addImage(path);
+    }
+    assetLoader.run();
+    sf::Vector2u layerSizes[3];
+    for (int i = 0; i < 3; ++i) {
+        const sf::Image* image = assetLoader.getImage(layerPaths[i]);
+        if (!image) return false;
+        layerSizes[i] = image->getSize();
+    }
+
+    Background background(layerPaths[0], layerPaths[1], layerPaths[2], WINDOW_SIZE);
+    background.setLayerSizes(layerSizes[0], layerSizes[1], layerSizes[2]);
+
+    measure("background_build_vertices", 1, 1000000, [&](int step) {
+        background.buildVertices(WINDOW_SIZE, step * 3.0f, 1.0f / 60.0f);
+    });
+    return true;
+}
+
+void printResults() {
+    std::printf("{\n  \"benchmarks\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        std::printf("    {\"name\": \"%s\", \"size\": %lld, \"operations\": %lld, \"ns_per_op\": %.1f, \"allocs_per_op\": %.3f}%s\n",
+                    result.name.c_str(), result.size, result.operations, result.nsPerOp, result.allocsPerOp,
+                    i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+}
+
+} // namespace
+
+int main() {
+    ResourceCache::get().setGraphicsEnabled(false);
+    setKeyboardEnabled(false);
+
+    TextureAtlas atlas;
+    if (!loadAtlas(atlas)) {
+        std::cerr << "Failed to load textures (run vex_bench from the repository root)" << std::endl;
+        return 1;
+    }
+
+    LoadedLevel level3;
+    if (!buildLevel("levels/level3.txt", atlas, level3)) {
+        std::cerr << "Failed to load levels/level3.txt" << std::endl;
+        return 1;
+    }
+
+    benchCollisionQuery();
+    benchPlayerUpdate();
+    benchOrbs(level3);
+    benchLevelLoad(atlas);
+    if (!benchBackground()) {
+        std::cerr << "Failed to load the background layers" << std::endl;
+        return 1;
+    }
+
+    printResults();
+    return 0;
+}
@@ -0,0 +1,53 @@
+#ifndef ASSET_LOADER_HPP
+#define ASSET_LOADER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Startup loader: PNG decoding runs on a pool of worker threads, then run() does
+// the GPU uploads on the calling (render) thread, which owns the GL context.
+//
+// Textures queued with addTexture() go into the ResourceCache and stay pinned
+// for as long as the loader lives, so later getTexture() calls for the same
+// paths are cache hits. Images queued with addImage() are only decoded; they are
+// for callers that pack them themselves (the tile atlas) and can be dropped with
+// releaseImages() once used.
+class AssetLoader {
+public:
+    explicit AssetLoader(unsigned workerCount = std::thread::hardware_concurrency());
+
+    void addTexture(const std::string& path);
+    void addImage(const std::string& path);
+
+    // Decodes everything queued so far and uploads the textures. Returns false
+    // if any file failed to load; the rest are still loaded.
+    bool run();
+
+    const sf::Image* getImage(const std::string& path) const;
+    void releaseImages();
+
+    void printReport(std::ostream& out) const;
+
+private:
+    struct Job {
+        std::string path;
+        bool upload{false};
+        bool decoded{false};
+        sf::Image image;
+        float decodeMs{0.0f};
+        float uploadMs{0.0f};
+    };
+
+    unsigned workerCount;
+    std::vector<Job> jobs;
+    std::vector<std::shared_ptr<sf::Texture>> pinned;
+    float wallMs{0.0f};
+
+    void add(const std::string& path, bool upload);
+};
+
+#endif // ASSET_LOADER_HPP
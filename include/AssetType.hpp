@@ -20,5 +20,75 @@ enum class AssetType {
     Statue3 = 16
 };
 
-#endif // ASSET_TYPE_HPP
+enum class CollisionClass {
+    Solid,       // the whole tile collides
+    GrassTop,    // collides below a grass fringe of collisionTopOffset px
+    Decoration   // trees, buttons and statues; the player walks through them
+};
+
+// Bit per story level, for AssetInfo::paletteLevels
+constexpr unsigned levelBit(int level) { return 1u << (level - 1); }
+
+// Everything the game knows about one asset type. Adding a type means adding
+// its enum value and one row to ASSET_INFO.
+struct AssetInfo {
+    AssetType type;
+    const char* texturePath;     // packed into the tile atlas
+    CollisionClass collision;
+    float collisionTopOffset;
+    unsigned paletteLevels;      // levels whose editor palette offers it
+    int paletteKey;              // number key that selects it there, 0 for none
+};
+
+// Indexed by AssetType value - 1
+inline constexpr AssetInfo ASSET_INFO[] = {
+    {AssetType::Brick,       "assets/tutorial_level/left_grass.png", CollisionClass::Solid,      0.0f,  levelBit(1), 1},
+    {AssetType::Dripstone,   "assets/tutorial_level/dripstone.png",  CollisionClass::Solid,      0.0f,  levelBit(1), 2},
+    {AssetType::LeftRock,    "assets/tutorial_level/left_rock.png",  CollisionClass::Solid,      0.0f,  levelBit(1), 3},
+    {AssetType::RightRock,   "assets/tutorial_level/right_rock.png", CollisionClass::Solid,      0.0f,  levelBit(1), 4},
+    {AssetType::Tree,        "assets/tutorial_level/tree.png",       CollisionClass::Decoration, 0.0f,  0,           0},
+    {AssetType::Grassy,      "assets/tutorial_level/grassy.png",     CollisionClass::GrassTop,   16.0f, levelBit(1), 6},
+    {AssetType::Button,      "assets/tutorial_level/button.png",     CollisionClass::Decoration, 0.0f,  levelBit(2) | levelBit(3), 5},
+    {AssetType::Stair1,      "assets/level2/stair1.png",             CollisionClass::Solid,      0.0f,  levelBit(2), 1},
+    {AssetType::Stair2,      "assets/level2/stair2.png",             CollisionClass::Solid,      0.0f,  levelBit(2), 2},
+    {AssetType::RightStair1, "assets/level2/rightstair1.png",        CollisionClass::Solid,      0.0f,  levelBit(2), 3},
+    {AssetType::RightStair2, "assets/level2/rightstair2.png",        CollisionClass::Solid,      0.0f,  levelBit(2), 4},
+    {AssetType::Ground,      "assets/level2/floor.png",              CollisionClass::GrassTop,   16.0f, levelBit(2), 6},
+    {AssetType::Ground3,     "assets/level3/ground.png",             CollisionClass::GrassTop,   16.0f, levelBit(3), 1},
+    {AssetType::Platform3,   "assets/level3/platform.png",           CollisionClass::Solid,      0.0f,  levelBit(3), 2},
+    {AssetType::Brick3,      "assets/level3/brick.png",              CollisionClass::Solid,      0.0f,  levelBit(3), 3},
+    {AssetType::Statue3,     "assets/level3/statue.png",             CollisionClass::Decoration, 0.0f,  levelBit(3), 4},
+};
+
+constexpr int ASSET_TYPE_COUNT = static_cast<int>(sizeof(ASSET_INFO) / sizeof(ASSET_INFO[0]));
 
+constexpr bool assetInfoMatchesEnum() {
+    for (int i = 0; i < ASSET_TYPE_COUNT; ++i) {
+        if (static_cast<int>(ASSET_INFO[i].type) != i + 1) return false;
+    }
+    return true;
+}
+static_assert(assetInfoMatchesEnum(), "ASSET_INFO rows must be in AssetType order, starting at 1");
+
+constexpr bool isValidAssetType(int assetTypeInt) {
+    return assetTypeInt >= 1 && assetTypeInt <= ASSET_TYPE_COUNT;
+}
+
+constexpr const AssetInfo& getAssetInfo(AssetType type) {
+    return ASSET_INFO[static_cast<int>(type) - 1];
+}
+
+constexpr const char* getAssetTexturePath(AssetType type) {
+    return getAssetInfo(type).texturePath;
+}
+
+constexpr bool isSolidAssetType(AssetType type) {
+    return getAssetInfo(type).collision != CollisionClass::Decoration;
+}
+
+// Grass-topped tiles only collide below their grass fringe.
+constexpr bool hasGrassTop(AssetType type) {
+    return getAssetInfo(type).collision == CollisionClass::GrassTop;
+}
+
+#endif // ASSET_TYPE_HPP
@@ -2,21 +2,37 @@
 #define BACKGROUND_HPP
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class Background {
 public:
     Background(const std::string& backgroundFilePath, const std::string& middlegroundFilePath, const std::string& mountaintsFilePath, const sf::Vector2u& windowSize);
     void render(sf::RenderWindow& window, const sf::Vector2u& windowSize, float playerX, float deltaTime);
+    // Scrolls the layers and refills their quads; render() calls this before drawing
+    void buildVertices(const sf::Vector2u& windowSize, float playerX, float deltaTime);
+    // Layer sizes come from the textures; with graphics disabled the textures
+    // are empty, so headless callers pass the decoded image sizes here instead
+    void setLayerSizes(const sf::Vector2u& background, const sf::Vector2u& middleground, const sf::Vector2u& mountains);
 
 private:
-    sf::Texture backgroundTexture;
+    std::shared_ptr<sf::Texture> backgroundTexture;
     sf::Sprite backgroundSprite;
 
-    sf::Texture middlegroundTexture;
+    std::shared_ptr<sf::Texture> middlegroundTexture;
     sf::Sprite middlegroundSprite;
 
-    sf::Texture mountainsTexture;
+    std::shared_ptr<sf::Texture> mountainsTexture;
     sf::Sprite mountainsSprite;
+
+    // One quad per layer, rebuilt every frame in place
+    sf::VertexArray backgroundVertices;
+    sf::VertexArray mountainsVertices;
+    sf::VertexArray middlegroundVertices;
+    sf::Vector2f backgroundSize;
+    sf::Vector2f middlegroundSize;
+    sf::Vector2f mountainsSize;
+    float mountainsScrollOffset{0.0f};
+    float middlegroundScrollOffset{0.0f};
 };
 
 #endif // BACKGROUND_HPP
@@ -4,37 +4,47 @@
 #define BUTTON_INTERACTION_HPP
 
 #include <SFML/Graphics.hpp>
-#include <chrono>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <utility>
 #include "AssetType.hpp"
+#include "TileMap.hpp"
 
+// Button prompts. The handleInteraction* calls only update state; draw()
+// shows the prompt they left visible. Their deltaTime times how long the text
+// stays up after F is pressed.
 class ButtonInteraction {
 public:
     ButtonInteraction();
-    void handleInteraction(const sf::Vector2f& playerPos, const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions,
-                           sf::RenderWindow& window, bool& enemyTriggered, bool& enemyDescending, bool& enemySpawned);
+    void handleInteraction(const sf::Vector2f& playerPos, const TileMap& tileMap,
+                           bool& enemyTriggered, bool& enemyDescending, bool& enemySpawned, float deltaTime);
 
-    void handleInteractionLevel2(const sf::Vector2f& playerPos, const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions, 
-                           sf::RenderWindow& window, bool& enemyTriggered, bool& enemyDescending, bool& sentinelDescendLevel2);
+    void handleInteractionLevel2(const sf::Vector2f& playerPos, const TileMap& tileMap, 
+                           bool& enemyTriggered, bool& enemyDescending, bool& sentinelDescendLevel2, float deltaTime);
 
-    void handleInteractionLevel3(const sf::Vector2f& playerPos, const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions, 
-                           sf::RenderWindow& window, bool& enemyTriggered, bool& enemyDescending, bool& sentinelDescendLevel3);
+    void handleInteractionLevel3(const sf::Vector2f& playerPos, const TileMap& tileMap, 
+                           bool& enemyTriggered, bool& enemyDescending, bool& sentinelDescendLevel3, float deltaTime);
+    void draw(sf::RenderWindow& window) const;
     void resetPrompt();
     void resetAllFlags();  // Add this new method
 
 private:
-    sf::Font font;
+    static constexpr float INTERACTION_RADIUS = 100.0f;
+
+    std::shared_ptr<sf::Font> font;
     sf::Text text;
     bool showingText;
     bool promptVisible;
-    int displayDuration;
-    std::chrono::steady_clock::time_point timerStart;
+    bool textVisible;
+    float displayDuration;
+    float displayTimer;  // game time since F was pressed
     bool interactionInProgress;
 
     float distance(const sf::Vector2f& a, const sf::Vector2f& b);
+    // Cells whose tiles could be within INTERACTION_RADIUS of position
+    static sf::IntRect cellsNear(const TileMap& tileMap, const sf::Vector2f& position);
 };
 
 extern bool resetSentinelInteraction;
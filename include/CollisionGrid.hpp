@@ -0,0 +1,79 @@
+#ifndef COLLISION_GRID_HPP
+#define COLLISION_GRID_HPP
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "GridKey.hpp"
+
+// Level-owned uniform grid over the solid boxes of a level, keyed on the editor's
+// 64px cells. Collision queries only visit the cells an area overlaps, so their
+// cost depends on what is near the query rather than how big the level is.
+// The boxes are each solid tile's collision bounds merged at load
+// time, so there are no seams between neighbouring tiles.
+class CollisionGrid {
+public:
+    explicit CollisionGrid(float cellSize = 64.0f);
+
+    void build(const std::vector<sf::FloatRect>& solidBoxes);
+    void clear();
+
+    // Incremental edits for the level editor. insert() files one more box;
+    // extract() removes and returns every box overlapping area. Both only touch
+    // the cells involved, and boxes are swap-removed so indices stay dense.
+    void insert(const sf::FloatRect& box);
+    std::vector<sf::FloatRect> extract(const sf::FloatRect& area);
+
+    // Merges runs of touching boxes that share an edge span into maximal
+    // axis-aligned boxes: first along rows, then stacking equal-width runs.
+    static std::vector<sf::FloatRect> mergeBoxes(std::vector<sf::FloatRect> solidBoxes);
+
+    // Calls visit(box) once for every solid box whose cells overlap area. Boxes
+    // that span several cells are reported from the first overlapping cell only.
+    template <typename Visitor>
+    void query(const sf::FloatRect& area, Visitor&& visit) const;
+
+    const std::vector<sf::FloatRect>& getBoxes() const { return boxes; }
+    std::size_t getCellCount() const { return cells.size(); }
+    float getCellSize() const { return cellSize; }
+
+private:
+    struct CellRange {
+        int minX, minY, maxX, maxY;
+    };
+
+    float cellSize;
+    std::vector<sf::FloatRect> boxes;
+    std::unordered_map<GridKey, std::vector<std::uint32_t>> cells;
+
+    void link(std::uint32_t index);
+    void unlink(std::uint32_t index);
+    void removeAt(std::uint32_t index);
+    CellRange cellRange(const sf::FloatRect& area) const;
+};
+
+template <typename Visitor>
+void CollisionGrid::query(const sf::FloatRect& area, Visitor&& visit) const {
+    if (cells.empty()) return;
+
+    CellRange range = cellRange(area);
+    for (int cellY = range.minY; cellY <= range.maxY; ++cellY) {
+        for (int cellX = range.minX; cellX <= range.maxX; ++cellX) {
+            auto cellIt = cells.find(gridKey(cellX, cellY));
+            if (cellIt == cells.end()) continue;
+
+            for (std::uint32_t index : cellIt->second) {
+                const sf::FloatRect& box = boxes[index];
+                CellRange boxRange = cellRange(box);
+                if (std::max(boxRange.minX, range.minX) == cellX && std::max(boxRange.minY, range.minY) == cellY) {
+                    visit(box);
+                }
+            }
+        }
+    }
+}
+
+#endif // COLLISION_GRID_HPP
@@ -0,0 +1,26 @@
+#ifndef CURSOR_MANAGER_HPP
+#define CURSOR_MANAGER_HPP
+
+#include <SFML/Window.hpp>
+
+// Owns the mouse cursor state for the game window. Visibility goes through
+// sf::Window::setMouseCursorVisible, and only when it actually changes, so
+// show()/hide() are free to call from the event loop.
+//
+// window.create() brings the cursor back; call show() before recreating the
+// window so the cached state matches what the new window starts with.
+class CursorManager {
+public:
+    explicit CursorManager(sf::Window& window, bool visible = true);
+
+    void show() { setVisible(true); }
+    void hide() { setVisible(false); }
+    void setVisible(bool visible);
+    bool isVisible() const { return visible; }
+
+private:
+    sf::Window& window;
+    bool visible;
+};
+
+#endif // CURSOR_MANAGER_HPP
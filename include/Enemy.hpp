@@ -1,7 +1,8 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <vector>
-#include "Platform.hpp"
+#include "CollisionGrid.hpp"
 
 class Enemy {
 public:
@@ -14,13 +15,15 @@ public:
     };
 
     Enemy(float startX = 500.0f, float startY = 500.0f);
-    void update(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight);
-    void draw(sf::RenderWindow& window) const;
+    void update(float deltaTime, const CollisionGrid& collisionGrid, int windowWidth, int windowHeight);
+    // alpha blends between the previous and current simulation step (1 = latest state)
+    void draw(sf::RenderWindow& window, float alpha = 1.0f) const;
+    void storePreviousState() { previousStatePosition = sprite.getPosition(); }
     sf::FloatRect getGlobalBounds() const;
     EnemyState getState() const;
     void setState(EnemyState newState);
     bool checkCollision(const sf::FloatRect& otherBounds) const;
-    void move(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight);
+    void move(float deltaTime, const CollisionGrid& collisionGrid, int windowWidth, int windowHeight);
     sf::Vector2f getPosition() const;
     void setPosition(float newX, float newY);
     void flipSprite();
@@ -47,9 +50,9 @@ private:
     float speedX;
     bool isFacingRight;
     int orbCount;
-    sf::Texture walkingTexture;
-    sf::Texture idleTexture;
+    std::shared_ptr<sf::Texture> walkingTexture;  // shared by every enemy
     sf::Sprite sprite;
+    sf::Vector2f previousStatePosition;
     sf::IntRect currentFrame;
     int currentFrameIndex;
     float animationTimer;
@@ -0,0 +1,99 @@
+#ifndef GAME_SESSION_HPP
+#define GAME_SESSION_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "ButtonInteraction.hpp"
+#include "Enemy.hpp"
+#include "LevelStreamer.hpp"
+#include "Player.hpp"
+#include "SentinelInteraction.hpp"
+#include "TextureAtlas.hpp"
+
+// One run of the story: the level being played, the player, the sentinel and
+// the flags that tie them together. Nothing in here needs a window. step() and
+// update() advance the game and draw() is a separate pass over the result,
+// so the same session is played on screen and simulated headless.
+class GameSession {
+public:
+    static constexpr float SCREEN_WIDTH = 1920.0f;
+    static constexpr float SCREEN_HEIGHT = 1080.0f;
+    static constexpr int LEVEL_COUNT = 3;
+
+    explicit GameSession(const TextureAtlas& atlas);
+
+    GameSession(const GameSession&) = delete;
+    GameSession& operator=(const GameSession&) = delete;
+
+    // One fixed simulation step: sentinel descent, the boss fight, the player and the enemy
+    void step(float stepTime);
+    // Once per frame, after the steps: sentinel dialogue, buttons and moving on to the next level
+    void update(float deltaTime);
+    // Tiles, dialogue, characters and the boss fight, with the camera view set
+    void draw(sf::RenderWindow& window, float interpolation);
+
+    // Centres the camera on focusX, kept inside the level horizontally. While
+    // editing the camera may look one extra screen past the right edge so
+    // levels can be extended.
+    void moveCamera(float focusX);
+    float getPlayerFocusX(float interpolation) const;
+    // Puts the camera back on the level's first screen
+    void resetCamera();
+
+    // Back to level 1 (after the victory screen)
+    void restart();
+    // Skips the story and starts the level 3 boss fight, for soak runs
+    void startBossFight();
+
+    void setEditing(bool editing) { this->editing = editing; }
+    bool isEditing() const { return editing; }
+    bool isVictorious() const { return sentinelInteraction.isVictorious(); }
+    int getCurrentLevel() const { return currentLevel; }
+
+    // Hash of the simulation state (level, story flags, player, sentinel, boss
+    // and orbs), continued from seed so a run can chain one per frame. Two runs
+    // fed the same input must produce the same chain.
+    static constexpr std::uint64_t CHECKSUM_SEED = 14695981039346656037ull;
+    std::uint64_t getChecksum(std::uint64_t seed = CHECKSUM_SEED) const;
+
+    LoadedLevel& getLevel() { return level; }
+    const LoadedLevel& getLevel() const { return level; }
+    LevelStreamer& getLevelStreamer() { return levelStreamer; }
+    const sf::View& getView() const { return view; }
+    sf::View& getView() { return view; }
+    const Player& getPlayer() const { return *player; }
+    const Enemy& getEnemy() const { return *enemy; }
+    SentinelInteraction& getSentinelInteraction() { return sentinelInteraction; }
+    const SentinelInteraction& getSentinelInteraction() const { return sentinelInteraction; }
+
+private:
+    const TextureAtlas& atlas;
+    sf::View view;
+    std::unique_ptr<Player> player;
+    std::unique_ptr<Enemy> enemy;
+    LoadedLevel level;
+    LevelStreamer levelStreamer;
+    ButtonInteraction buttonInteraction;
+    SentinelInteraction sentinelInteraction;
+    std::shared_ptr<sf::Font> font;
+    sf::Text text;
+
+    bool editing{false};
+    int currentLevel{1};
+    bool enemyTriggered{false};
+    bool enemyDescending{false};
+    bool enemySpawned{false};
+    bool proceedToNextLevel{false};
+    bool sentinelDescendLevel2{false};
+    bool sentinelDescendLevel3{false};
+    bool playerJustReset{false};
+    bool sentinelActive{false};  // the sentinel's dialogue ran this frame
+
+    void advanceLevel();
+    void resetPlayer();
+    void teleportEnemy(float x, float y);
+};
+
+#endif // GAME_SESSION_HPP
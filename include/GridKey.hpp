@@ -0,0 +1,23 @@
+#ifndef GRID_KEY_HPP
+#define GRID_KEY_HPP
+
+#include <cstdint>
+
+// Hash key for a signed (x, y) pair of cell or chunk coordinates: x in the high
+// 32 bits, y in the low 32. Both are packed as unsigned values, so cells left of
+// or above the origin don't left-shift a negative number.
+using GridKey = std::uint64_t;
+
+inline GridKey gridKey(int x, int y) {
+    return (static_cast<GridKey>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+}
+
+inline int gridKeyX(GridKey key) {
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(key >> 32));
+}
+
+inline int gridKeyY(GridKey key) {
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(key));
+}
+
+#endif // GRID_KEY_HPP
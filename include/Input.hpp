@@ -0,0 +1,45 @@
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <SFML/Window.hpp>
+#include <cstdint>
+
+// Gameplay reads the keyboard through a per-frame snapshot: pollInput() samples
+// every key in INPUT_KEYS once at the top of the frame, and isKeyPressed() then
+// answers from that snapshot. A replay sets the snapshot with setInputFrame()
+// instead, so the game can't tell a replayed frame from a live one.
+//
+// sf::Keyboard asks the display server, which headless runs don't have, so with
+// the keyboard disabled pollInput() leaves every key released.
+
+// One bit per INPUT_KEYS entry
+using InputFrame = std::uint32_t;
+
+// Bit order of an InputFrame. Recordings store these bits, so new keys go at the end.
+const sf::Keyboard::Key INPUT_KEYS[] = {
+    sf::Keyboard::A,      // move left
+    sf::Keyboard::D,      // move right
+    sf::Keyboard::Space,  // jump, leave the victory screen
+    sf::Keyboard::F,      // press a button
+    sf::Keyboard::Y,      // sentinel dialogue answers
+    sf::Keyboard::N,
+    sf::Keyboard::Q,
+    sf::Keyboard::T,
+    sf::Keyboard::Up,     // title menu
+    sf::Keyboard::Down,
+    sf::Keyboard::Enter,
+    sf::Keyboard::Left,   // editor camera pan
+    sf::Keyboard::Right,
+};
+const int INPUT_KEY_COUNT = static_cast<int>(sizeof(INPUT_KEYS) / sizeof(INPUT_KEYS[0]));
+static_assert(INPUT_KEY_COUNT <= 32, "every input key needs a bit in InputFrame");
+
+void setKeyboardEnabled(bool enabled);
+void pollInput();
+void setInputFrame(InputFrame frame);
+InputFrame getInputFrame();
+
+// Keys outside INPUT_KEYS always read as released
+bool isKeyPressed(sf::Keyboard::Key key);
+
+#endif // INPUT_HPP
@@ -0,0 +1,53 @@
+#ifndef INPUT_RECORDING_HPP
+#define INPUT_RECORDING_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Input.hpp"
+
+// The input of one uninterrupted stretch of play, one InputFrame per frame.
+// Every recorded frame advances the game by the same fixed frame time, so
+// feeding the frames back through setInputFrame() replays the run step for
+// step, in a window or headless.
+//
+// The run's RandomService seed is stored with it; a replay reseeds with it
+// before its first frame.
+//
+// File layout (version 2, little-endian):
+//   header  "VEXR", version, flags, frameCount, runCount, reserved (u32 each), checksum, seed (u64 each)
+//   runs    runCount x { u32 keys, u32 length }, one per stretch of identical frames
+// Held keys and idle stretches collapse into single runs, so a few minutes of
+// play come to a few kilobytes.
+const std::uint32_t INPUT_RECORDING_VERSION = 2;
+
+class InputRecording {
+public:
+    void clear();
+    void append(InputFrame frame) { frames.push_back(frame); }
+
+    std::size_t getFrameCount() const { return frames.size(); }
+    InputFrame getFrame(std::size_t index) const { return frames[index]; }
+
+    // The run skipped the story and started at the level 3 boss fight
+    void setStartsAtBossFight(bool bossFight) { this->bossFight = bossFight; }
+    bool startsAtBossFight() const { return bossFight; }
+
+    // GameSession checksum chained over every frame of the run
+    void setChecksum(std::uint64_t checksum) { this->checksum = checksum; }
+    std::uint64_t getChecksum() const { return checksum; }
+
+    void setSeed(std::uint64_t seed) { this->seed = seed; }
+    std::uint64_t getSeed() const { return seed; }
+
+    bool saveToFile(const std::string& filepath) const;
+    bool loadFromFile(const std::string& filepath);
+
+private:
+    std::vector<InputFrame> frames;
+    bool bossFight{false};
+    std::uint64_t checksum{0};
+    std::uint64_t seed{0};
+};
+
+#endif // INPUT_RECORDING_HPP
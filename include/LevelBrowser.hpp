@@ -0,0 +1,55 @@
+#ifndef LEVEL_BROWSER_HPP
+#define LEVEL_BROWSER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// In-game save/load panel for the editor, drawn over the running level. It lists
+// the level files in one directory. Load picks one; Save picks one to overwrite
+// or takes a typed name. It replaces the native file dialog, which needed the
+// fullscreen window torn down and recreated around it.
+//
+// While open it takes every event; main() keeps gameplay paused until it closes.
+class LevelBrowser {
+public:
+    enum class Mode { Closed, Save, Load };
+
+    explicit LevelBrowser(const std::string& directory = "levels");
+
+    void openSave(const std::string& currentPath);
+    void openLoad();
+    void close();
+    bool isOpen() const { return mode != Mode::Closed; }
+    Mode getMode() const { return mode; }
+
+    // Returns true once the user confirms; getSelectedPath() then holds the
+    // file to save to / load from. The browser closes itself when that happens.
+    bool handleEvent(const sf::Event& event, const sf::RenderWindow& window);
+    const std::string& getSelectedPath() const { return selectedPath; }
+
+    // Drawn in screen space with the window's default view.
+    void draw(sf::RenderWindow& window) const;
+
+private:
+    static constexpr float PANEL_WIDTH = 640.0f;
+    static constexpr float ROW_HEIGHT = 32.0f;
+    static constexpr int VISIBLE_ROWS = 16;
+
+    std::string directory;
+    Mode mode{Mode::Closed};
+    std::vector<std::string> files;  // file names in directory, sorted
+    int selection{-1};
+    int firstVisibleRow{0};
+    std::string fileName;  // Save mode text entry
+    std::string selectedPath;
+    std::shared_ptr<sf::Font> font;
+
+    void refreshFiles();
+    void select(int index);
+    bool confirm();
+    sf::FloatRect getPanelBounds(const sf::Vector2f& screenSize) const;
+};
+
+#endif // LEVEL_BROWSER_HPP
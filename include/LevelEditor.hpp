@@ -1,23 +1,78 @@
-#pragma once
+#ifndef LEVEL_EDITOR_HPP
+#define LEVEL_EDITOR_HPP
+
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
-#include <string>
-// #include <memory> soon 
+#include "AssetType.hpp"
+#include "GridKey.hpp"
+#include "LevelStreamer.hpp"
+#include "TextureAtlas.hpp"
 
+// Places and removes tiles in the level being played. Edits go straight into
+// the level's TileMap, so an edit costs O(1) per cell however big the level
+// is, and the tile layer and collision grid are patched around the edited
+// cells instead of being rebuilt. Props off the grid aren't editable.
+//
+// Every tool applies its cells as one batch: the tile layer and collision grid
+// are updated once per stroke, fill or rectangle rather than once per cell.
+//   B       brush (left paints, right erases); [ and ] change its size
+//   R       rectangle: drag with left to fill, right to clear
+//   F       flood fill: left fills the empty area under the cursor (within the
+//           level's bounds), right erases the connected tiles of that type
 class LevelEditor {
 public:
-  LevelEditor(float gridSize, const std::vector<sf::Texture> &textures);
+    enum class Tool { Brush, Rectangle, FloodFill };
+
+    static constexpr int MAX_BRUSH_SIZE = 8;
+
+    explicit LevelEditor(const TextureAtlas& atlas, float gridSize = 64.0f);
+
+    // Call again whenever a different level has been swapped in.
+    void attach(LoadedLevel& level);
+
+    void handleEvent(const sf::Event& event, const sf::RenderWindow& window, AssetType currentAsset);
+    // Applies the brush while a mouse button is held.
+    void update(const sf::RenderWindow& window, AssetType currentAsset);
+    // Outlines the cells the current tool would change, in world space.
+    void drawCursor(sf::RenderWindow& window) const;
+
+    Tool getTool() const { return tool; }
+    int getBrushSize() const { return brushSize; }
+    bool hasTile(const sf::Vector2f& worldPos) const;
 
-  void run();
-  void drawGrid(sf::RenderWindow& window);
-  void handleInput(sf::RenderWindow& window);
-  void saveLevel(const std::string& filename);
-  void loadLevel(const std::string& filename);
+    // Batched edits; each returns the number of cells it changed.
+    std::size_t paint(const sf::Vector2f& worldPos, AssetType type);
+    std::size_t erase(const sf::Vector2f& worldPos);
+    std::size_t fillRectangle(const sf::Vector2f& from, const sf::Vector2f& to, AssetType type);
+    std::size_t eraseRectangle(const sf::Vector2f& from, const sf::Vector2f& to);
+    std::size_t floodFill(const sf::Vector2f& worldPos, AssetType type);
+    std::size_t floodErase(const sf::Vector2f& worldPos);
 
 private:
-  float gridSize;
-  std::vector<sf::Texture> textures;
-  std::vector<sf::RectangleShape> placedTiles;
-  sf::Texture* selectedTexture;
-  sf::RectangleShape previewTile;
+    const TextureAtlas& atlas;
+    float gridSize;
+    LoadedLevel* level{nullptr};
+
+    Tool tool{Tool::Brush};
+    int brushSize{1};
+    bool draggingRectangle{false};
+    sf::Mouse::Button dragButton{sf::Mouse::Left};
+    sf::Vector2f dragStart;
+
+    std::size_t placeCells(const std::vector<sf::Vector2i>& targets, AssetType type);
+    std::size_t eraseCells(const std::vector<sf::Vector2i>& targets);
+    std::vector<sf::Vector2i> brushCells(const sf::Vector2f& worldPos) const;
+    std::vector<sf::Vector2i> rectangleCells(const sf::Vector2f& from, const sf::Vector2f& to) const;
+    sf::IntRect cellRect(const sf::Vector2f& from, const sf::Vector2f& to) const;
+
+    sf::Vector2i toCell(const sf::Vector2f& worldPos) const;
+    sf::FloatRect collisionBox(const sf::Vector2f& position, AssetType type) const;
+    void addCollision(const std::vector<sf::FloatRect>& added);
+    void removeCollision(const std::vector<sf::FloatRect>& removed);
+
+    static GridKey cellKey(const sf::Vector2i& cell) { return gridKey(cell.x, cell.y); }
 };
+
+#endif // LEVEL_EDITOR_HPP
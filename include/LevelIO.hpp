@@ -0,0 +1,46 @@
+#ifndef LEVEL_IO_HPP
+#define LEVEL_IO_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AssetType.hpp"
+
+// Levels come in two formats:
+//   - text (.txt): one "x y type" line per tile, written by the editor
+//   - binary (.vexl): a fixed header, the tile array and the level's merged
+//     collision boxes, laid out so the file can be mapped and copied straight
+//     into memory. vex_levelc converts text levels to this format.
+//
+// Binary layout (version 1, little-endian, every section 4-byte aligned):
+//   header  "VEXL", version, tileCount, collisionBoxCount, tileOffset, collisionBoxOffset  (u32 each)
+//   tiles   tileCount x { f32 x, f32 y, u32 type }
+//   boxes   collisionBoxCount x { f32 left, f32 top, f32 width, f32 height }
+const std::uint32_t LEVEL_FILE_VERSION = 1;
+
+struct LevelData {
+    std::vector<std::pair<sf::Vector2f, AssetType>> tiles;
+    std::vector<sf::FloatRect> collisionBoxes;  // merged, ready for CollisionGrid::build
+};
+
+// Solid boxes for a tile list, merged into maximal rectangles. assetSizes is
+// indexed by AssetType value; types with no size don't collide.
+std::vector<sf::FloatRect> buildCollisionBoxes(const std::vector<std::pair<sf::Vector2f, AssetType>>& tiles,
+                                               const std::vector<sf::Vector2f>& assetSizes);
+
+bool loadLevelText(const std::string& filepath, std::vector<std::pair<sf::Vector2f, AssetType>>& tiles);
+bool saveLevelText(const std::string& filepath, const std::vector<std::pair<sf::Vector2f, AssetType>>& tiles);
+bool loadLevelBinary(const std::string& filepath, LevelData& level);
+bool saveLevelBinary(const std::string& filepath, const LevelData& level);
+
+// "levels/level1.txt" -> "levels/level1.vexl"
+std::string getBinaryLevelPath(const std::string& filepath);
+
+// Loads a level by path. A .vexl next to a .txt is used instead of the text
+// file when it is at least as new; otherwise the text is parsed and the
+// collision boxes are built from assetSizes.
+bool loadLevelData(const std::string& filepath, LevelData& level, const std::vector<sf::Vector2f>& assetSizes);
+
+#endif // LEVEL_IO_HPP
@@ -0,0 +1,61 @@
+#ifndef LEVEL_STREAMER_HPP
+#define LEVEL_STREAMER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <future>
+#include <memory>
+#include <string>
+#include "CollisionGrid.hpp"
+#include "SolidityGrid.hpp"
+#include "TextureAtlas.hpp"
+#include "TileLayer.hpp"
+#include "TileMap.hpp"
+
+// Everything the game keeps for the level being played, built in one go so it
+// can be put together off the render thread and swapped in as a whole.
+struct LoadedLevel {
+    std::string path;
+    TileMap tileMap;
+    CollisionGrid collisionGrid;
+    SolidityGrid solidity;
+    TileLayer tileLayer;
+
+    // Area the camera and player are kept in. Levels scroll sideways only: the
+    // width spans every tile's cell (at least one 1920px screen), the height is
+    // always the 1080px screen.
+    sf::FloatRect getWorldBounds() const;
+};
+
+// Reads the level at path and builds its tile map, collision and solidity.
+// None of it touches GL, so this is safe to run on a worker thread as long as
+// the atlas isn't modified meanwhile.
+bool buildLevel(const std::string& path, const TextureAtlas& atlas, LoadedLevel& level);
+
+// Builds the next level on a worker thread while the current one plays.
+// take() then hands it over with a single move on the render thread. If the
+// preload hasn't finished it waits for it; if a different level was
+// preloaded (or none), it builds the requested one synchronously.
+class LevelStreamer {
+public:
+    explicit LevelStreamer(const TextureAtlas& atlas);
+    ~LevelStreamer();
+
+    LevelStreamer(const LevelStreamer&) = delete;
+    LevelStreamer& operator=(const LevelStreamer&) = delete;
+
+    void preload(const std::string& path);
+    bool isReady(const std::string& path) const;
+    bool take(const std::string& path, LoadedLevel& level);
+
+    // Drops a preload of path, e.g. because the editor just overwrote the file.
+    void invalidate(const std::string& path);
+
+private:
+    const TextureAtlas& atlas;
+    std::string pendingPath;
+    std::future<std::unique_ptr<LoadedLevel>> pending;
+
+    void discardPending();
+};
+
+#endif // LEVEL_STREAMER_HPP
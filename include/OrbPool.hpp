@@ -0,0 +1,43 @@
+#ifndef ORB_POOL_HPP
+#define ORB_POOL_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Structure-of-arrays storage for the sentinel's orbs. Each field lives in its
+// own tightly packed array so the per-frame update streams through memory, dead
+// orbs are removed by swapping in the last one, and the whole pool is drawn from
+// a single vertex array.
+class OrbPool {
+public:
+    explicit OrbPool(float radius = 10.0f);
+
+    // Positions are the top-left corner of the orb's bounding box, like sf::CircleShape.
+    std::vector<float> posX, posY;
+    std::vector<float> dirX, dirY;
+    std::vector<float> angle;            // degrees
+    std::vector<std::uint8_t> pattern;   // owner-defined pattern/type id, also picks the palette color
+
+    std::size_t size() const { return posX.size(); }
+    bool empty() const { return posX.empty(); }
+    float getRadius() const { return radius; }
+
+    void spawn(float x, float y, float angleDegrees, std::uint8_t patternId);
+    void remove(std::size_t index);  // swap-and-pop: order is not preserved
+    void clear();
+    void reserve(std::size_t count);
+
+    bool intersects(const sf::FloatRect& bounds) const;
+
+    // Rebuilds vertices as one triangle list for every orb, colored by palette[pattern].
+    void buildVertices(sf::VertexArray& vertices, const std::vector<sf::Color>& palette) const;
+
+private:
+    static constexpr int SEGMENTS = 8;
+
+    float radius;
+    sf::Vector2f circleOffsets[SEGMENTS + 1];
+};
+
+#endif // ORB_POOL_HPP
@@ -1,7 +1,8 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <vector>
-#include "Platform.hpp"
+#include "CollisionGrid.hpp"
 #include "Enemy.hpp"
 #include "SentinelInteraction.hpp"
 
@@ -13,8 +14,10 @@ public:
     Player(float startX = 0.0f, float startY = 500.0f);
 
     // Core game loop methods
-    void update(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight, Enemy& enemy);
-    void draw(sf::RenderWindow& window) const;
+    void update(float deltaTime, const CollisionGrid& collisionGrid, const sf::FloatRect& worldBounds, Enemy& enemy);
+    // alpha blends between the previous and current simulation step (1 = latest state)
+    void draw(sf::RenderWindow& window, float alpha = 1.0f) const;
+    void storePreviousState();
     
     // Collision and bounds
     sf::FloatRect getGlobalBounds() const;
@@ -25,6 +28,8 @@ public:
     
     // Position getters and setters
     sf::Vector2f getPosition() const;
+    // Render position between the last two simulation steps, for the camera
+    sf::Vector2f getInterpolatedPosition(float alpha) const;
     void setPosition(float newX, float newY);
     
     // State management
@@ -48,6 +53,7 @@ private:
     // Position and movement variables
     float x, y;
     float prevX, prevY;
+    sf::Vector2f previousStatePosition;  // position at the start of the last simulation step
     float yVelocity;
     const float gravity;
     const float terminalVelocity;
@@ -60,10 +66,10 @@ private:
     int orbCount;
 
     // Sprite and animation variables
-    sf::Texture walkingTexture;
-    sf::Texture idleTexture;
-    sf::Texture jumpTexture;
-    sf::Texture deathTexture;
+    std::shared_ptr<sf::Texture> walkingTexture;
+    std::shared_ptr<sf::Texture> idleTexture;
+    std::shared_ptr<sf::Texture> jumpTexture;
+    std::shared_ptr<sf::Texture> deathTexture;
     sf::Sprite sprite;
     sf::IntRect currentFrame;
     int currentFrameIndex;
@@ -93,8 +99,8 @@ private:
     // Movement and physics methods
     void handleInput(float deltaTime);
     void applyGravity(float deltaTime);
-    void move(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight, Enemy& enemy);
-    void boundDetection(int windowWidth, int windowHeight);
+    void move(float deltaTime, const CollisionGrid& collisionGrid, const sf::FloatRect& worldBounds, Enemy& enemy);
+    void boundDetection(const sf::FloatRect& worldBounds);
     void enemyDetection(Enemy& enemy);
 
     // Animation methods
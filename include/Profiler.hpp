@@ -0,0 +1,103 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include "TraceRecorder.hpp"
+
+// Per-frame timings for the main thread's subsystems. VEX_PROFILE_SCOPE(zone)
+// adds the time until the end of the enclosing block to that zone's total for
+// the current frame (a zone entered several times per frame, like the fixed
+// simulation steps, sums up), and VEX_PROFILE_FRAME() closes the frame into a
+// ring of the last HISTORY_FRAMES frames.
+//
+// Every zone (and each whole frame) also goes to the TraceRecorder while it
+// is recording.
+//
+// F3 toggles an overlay with each zone's rolling average, p99 and worst frame.
+// Configuring with -DVEX_PROFILING=OFF compiles every timer out.
+
+enum class ProfileZone {
+    Frame,  // whole frame, filled in by VEX_PROFILE_FRAME()
+    Events,
+    PlayerUpdate,
+    EnemyUpdate,
+    BossFight,
+    Orbs,
+    Background,
+    TileDraw,
+    Display,
+    Count
+};
+
+const char* getProfileZoneName(ProfileZone zone);
+
+class Profiler {
+public:
+    static constexpr int HISTORY_FRAMES = 240;
+    static constexpr int ZONE_COUNT = static_cast<int>(ProfileZone::Count);
+
+    struct ZoneStats {
+        float averageMs{0.0f};
+        float p99Ms{0.0f};
+        float worstMs{0.0f};
+    };
+
+    static Profiler& get();
+
+    void addSample(ProfileZone zone, float milliseconds) {
+        current[static_cast<int>(zone)] += milliseconds;
+    }
+    void endFrame();
+
+    // Over the frames currently in the ring
+    ZoneStats getStats(ProfileZone zone) const;
+    int getRecordedFrames() const { return recordedFrames; }
+
+    void toggleOverlay() { overlayVisible = !overlayVisible; }
+    bool isOverlayVisible() const { return overlayVisible; }
+    // Draws in screen space; restores the window's view afterwards.
+    void drawOverlay(sf::RenderWindow& window, const sf::Font& font) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::array<std::array<float, ZONE_COUNT>, HISTORY_FRAMES> history{};
+    std::array<float, ZONE_COUNT> current{};
+    int nextFrame{0};
+    int recordedFrames{0};
+    Clock::time_point frameStart{Clock::now()};
+    bool overlayVisible{false};
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileZone zone) : zone(zone), start(std::chrono::steady_clock::now()) {}
+    ~ProfileScope() {
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        Profiler::get().addSample(zone, std::chrono::duration<float, std::milli>(end - start).count());
+        if (TraceRecorder::get().isRecording()) TraceRecorder::get().record(getProfileZoneName(zone), start, end);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileZone zone;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define VEX_PROFILE_CONCAT_INNER(a, b) a##b
+#define VEX_PROFILE_CONCAT(a, b) VEX_PROFILE_CONCAT_INNER(a, b)
+
+#if VEX_PROFILING
+#define VEX_PROFILE_SCOPE(zone) ProfileScope VEX_PROFILE_CONCAT(profileScope, __LINE__)(ProfileZone::zone)
+#define VEX_PROFILE_FRAME() Profiler::get().endFrame()
+#else
+#define VEX_PROFILE_SCOPE(zone) ((void)0)
+#define VEX_PROFILE_FRAME() ((void)0)
+#endif
+
+#endif // PROFILER_HPP
@@ -0,0 +1,76 @@
+#ifndef RANDOM_SERVICE_HPP
+#define RANDOM_SERVICE_HPP
+
+#include <array>
+#include <cstdint>
+
+// xoshiro128**: 16 bytes of state, a handful of shifts and xors per number and
+// no locks. Each stream is owned by one subsystem (or one thread), so streams
+// never contend and one subsystem's draws don't shift another's sequence.
+class RandomStream {
+public:
+    explicit RandomStream(std::uint64_t seed = 0) { reseed(seed); }
+
+    // Expands seed with splitmix64, so nearby seeds still give unrelated sequences
+    void reseed(std::uint64_t seed);
+
+    std::uint32_t next() {
+        const std::uint32_t result = rotateLeft(state[1] * 5, 7) * 9;
+        const std::uint32_t shifted = state[1] << 9;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotateLeft(state[3], 11);
+        return result;
+    }
+
+    // In [0, bound); bound must be positive
+    int nextInt(int bound) {
+        return static_cast<int>((static_cast<std::uint64_t>(next()) * static_cast<std::uint32_t>(bound)) >> 32);
+    }
+    // In [0, 1)
+    float nextFloat() { return (next() >> 8) * (1.0f / 16777216.0f); }
+    bool nextBool() { return (next() >> 31) != 0; }
+
+private:
+    std::array<std::uint32_t, 4> state;
+
+    static std::uint32_t rotateLeft(std::uint32_t value, int bits) {
+        return (value << bits) | (value >> (32 - bits));
+    }
+};
+
+// Subsystems with their own stream, in the order their seeds are derived
+enum class RandomStreamId {
+    SentinelDialogue,  // whether the sentinel tells the truth
+    BossFight,         // attack patterns and gem positions
+    VictoryParticles,
+    Count
+};
+
+// Every random number in the game comes from here. One master seed derives
+// all the streams, so a run is reproduced by reseeding with the seed it
+// started from: replays store it, and --seed picks it.
+class RandomService {
+public:
+    static constexpr std::uint64_t DEFAULT_SEED = 1;
+
+    static RandomService& get();
+
+    // Restarts every stream from masterSeed. Streams are reseeded in place, so
+    // references handed out by getStream() stay valid.
+    void seed(std::uint64_t masterSeed);
+    std::uint64_t getSeed() const { return masterSeed; }
+
+    RandomStream& getStream(RandomStreamId id) { return streams[static_cast<int>(id)]; }
+
+private:
+    RandomService() { seed(DEFAULT_SEED); }
+
+    std::uint64_t masterSeed{DEFAULT_SEED};
+    std::array<RandomStream, static_cast<int>(RandomStreamId::Count)> streams;
+};
+
+#endif // RANDOM_SERVICE_HPP
@@ -0,0 +1,56 @@
+#ifndef RESOURCE_CACHE_HPP
+#define RESOURCE_CACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Process-wide cache of textures and fonts keyed by file path. Every class asks
+// the cache instead of loading its own copy, so a file is decoded (and uploaded)
+// once no matter how many objects use it. The cache only holds weak references:
+// a resource is freed when its last user goes away and reloaded on next request.
+//
+// Loads never return null. A file that fails to load is reported and handed out
+// as an empty texture/font (what the old per-class loaders left behind), and is
+// retried on the next request.
+//
+// With graphics disabled (headless runs, which have no GL context to upload
+// to) texture requests hand out empty textures without reading any file.
+class ResourceCache {
+public:
+    struct ResidentResource {
+        std::string path;
+        std::size_t bytes;  // decoded texture size, or font file size
+        long users;
+    };
+
+    static ResourceCache& get();
+
+    std::shared_ptr<sf::Texture> getTexture(const std::string& path);
+    // Uploads an image decoded elsewhere and caches it under path. Returns the
+    // cached texture instead if path is already resident.
+    std::shared_ptr<sf::Texture> addTexture(const std::string& path, const sf::Image& image);
+    std::shared_ptr<sf::Font> getFont(const std::string& path);
+
+    void setGraphicsEnabled(bool enabled) { graphicsEnabled = enabled; }
+    bool isGraphicsEnabled() const { return graphicsEnabled; }
+
+    std::vector<ResidentResource> getResidentResources() const;
+    std::size_t getResidentBytes() const;
+    void printReport(std::ostream& out) const;
+
+private:
+    struct FontEntry {
+        std::weak_ptr<sf::Font> font;
+        std::size_t bytes{0};
+    };
+
+    std::unordered_map<std::string, std::weak_ptr<sf::Texture>> textures;
+    std::unordered_map<std::string, FontEntry> fonts;
+    bool graphicsEnabled{true};
+};
+
+#endif // RESOURCE_CACHE_HPP
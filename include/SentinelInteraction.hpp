@@ -5,23 +5,26 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
-#include <random>
 #include <vector>
-#include <map>
 #include <array>
 #include "ButtonInteraction.hpp"
 #include "Enemy.hpp"
-#include "Platform.hpp"
+#include "OrbPool.hpp"
+#include "RandomService.hpp"
+#include "SolidityGrid.hpp"
 
 class Player;
 
+// The sentinel's dialogue on each level and the level 3 boss fight. The
+// trigger*/update* calls only advance state; the draw* calls render it, so the
+// fight also runs without a window. Orbs are culled against view.
 class SentinelInteraction {
 public:
-    SentinelInteraction(sf::RenderWindow& window, sf::View& view, std::unique_ptr<Player>& player, std::unique_ptr<Enemy>& enemy);
+    SentinelInteraction(const sf::View& view, std::unique_ptr<Player>& player, std::unique_ptr<Enemy>& enemy);
     void resetState();
     void startLevel2Interaction();
     void startLevel3Interaction();
-    void triggerInteraction(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void triggerInteraction(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                             bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                             const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
     bool isAscending() const;
@@ -29,34 +32,37 @@ public:
     bool canMove() const { return canPlayerMove; }
     void startBossFight(std::unique_ptr<Enemy>& enemy);
     void updateBossFight(float deltaTime, std::unique_ptr<Enemy>& enemy, const sf::Vector2f& playerPos);
+    // The player's answer options, while the last trigger call left them up
+    void drawDialogue(sf::RenderWindow& window) const;
     void drawBossFightElements(sf::RenderWindow& window);
     void createVictoryParticles();
     void updateVictoryScreen(float deltaTime);
     void drawVictoryScreen(sf::RenderWindow& window);
     
-    const std::vector<sf::CircleShape>& getOrbs() const {
-        static std::vector<sf::CircleShape> orbShapes;
-        orbShapes.clear();
-        for (const auto& orb : orbs) {
-            orbShapes.push_back(orb.shape);
-        }
-        return orbShapes;
-    }
+    bool isHitByOrb(const sf::FloatRect& bounds) const { return orbs.intersects(bounds); }
+    std::size_t getOrbCount() const { return orbs.size(); }
+    // Moves every orb one step and drops those that hit a solid cell or left
+    // the view. updateBossFight() calls it each step; vex_bench fills the pool
+    // directly through getOrbs() and times it on its own.
+    void handleOrbs(float deltaTime, const sf::Vector2f& playerPos);
+    OrbPool& getOrbs() { return orbs; }
+    const OrbPool& getOrbs() const { return orbs; }
+    float getBossHealth() const { return bossHealth; }
 
-    void setCurrentPlatforms(const std::vector<Platform>& newPlatforms) {
-        platforms = newPlatforms;
+    void setCurrentSolidity(const SolidityGrid& levelSolidity) {
+        solidity = levelSolidity;
     }
     
     bool isVictorious() const { return showVictoryScreen; }
     void checkGemCollision(const sf::Vector2f& playerPos);
 
-    void triggerInteractionLevel1(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void triggerInteractionLevel1(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                   bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                                   const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
-    void triggerInteractionLevel2(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void triggerInteractionLevel2(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                   bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                                   const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
-    void triggerInteractionLevel3(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void triggerInteractionLevel3(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                   bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                                   const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
 
@@ -72,48 +78,40 @@ private:
     static constexpr int ORBS_PER_WAVE = 5;
     static constexpr int COLLECTIONS_PER_WAVE = 2;
 
-    enum class AttackPattern {
+    enum class AttackPattern : std::uint8_t {
         DIRECT,
         SPIRAL,
         SHOTGUN,
         CROSS
     };
 
-    struct Orb {
-        sf::CircleShape shape;
-        sf::Vector2f direction{0.f, 0.f};
-        AttackPattern patternType;
-        float angle{0.0f};
-        
-        Orb(float radius, AttackPattern t) 
-            : shape(radius), patternType(t) {}
-    };
-
     struct Particle {
         sf::CircleShape shape;
         sf::Vector2f velocity;
         float lifetime;
     };
 
-    sf::RenderWindow& window;
-    sf::View& view;
+    const sf::View& view;
     std::unique_ptr<Player>& player;
     std::unique_ptr<Enemy>& enemy;
     
-    sf::Font font;
+    std::shared_ptr<sf::Font> font;
     sf::Text playerOptions;
+    bool dialogueOptionsVisible{false};
     bool questionVisible{false};
     bool ascent{false};
     bool awaitingResponse{false};
     bool responseComplete{false};
     bool awaitingFinalAnswer{false};
     bool sentinelHasAnswered{false};
-    std::random_device rd;
-    std::mt19937 rng;
-    std::uniform_int_distribution<int> dist;
+    RandomStream& dialogueRandom;
+    RandomStream& bossFightRandom;
+    RandomStream& particleRandom;
     bool sentinelTruth{false};
-    sf::Clock messageDisplayTimer;
-    sf::Time messageDisplayDuration;
+    // Game time since the sentinel's last message, advanced by the deltaTime of
+    // each triggerInteraction* call so replays see the same timing
+    float messageDisplayTimer;
+    float messageDisplayDuration;
     bool isCorrect{false};
     int currentLevel{1};
 
@@ -129,7 +127,9 @@ private:
 
     bool inBossFight{false};
     float bossHealth{MAX_HEALTH};
-    std::vector<Orb> orbs;
+    OrbPool orbs{10.f};
+    sf::VertexArray orbVertices;
+    std::vector<sf::Color> orbPalette;  // indexed by AttackPattern
     std::vector<sf::CircleShape> gems;
     sf::RectangleShape healthBar;
     sf::RectangleShape healthBarBackground;
@@ -156,10 +156,9 @@ private:
     std::array<int, TOTAL_WAVES> orbsPerPatternPerWave{{1, 3, 5}};
 
     std::vector<sf::Vector2f> tilePositions;
-    std::vector<Platform> platforms;
-    std::map<AssetType, sf::Texture> textureMap;
+    SolidityGrid solidity;
 
-    void handleInitialInteraction(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void handleInitialInteraction(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                   std::unique_ptr<Enemy>& enemy, float deltaTime,
                                   const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
     void handleQuestionResponse(sf::Text& text);
@@ -167,14 +166,14 @@ private:
     void handleAscentAndCleanup(std::unique_ptr<Enemy>& enemy, sf::Text& text, bool& enemyTriggered,
                                 bool& enemySpawned, ButtonInteraction& buttonInteraction, float deltaTime);
 
-    void handleInitialInteractionLevel2(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void handleInitialInteractionLevel2(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                         std::unique_ptr<Enemy>& enemy, float deltaTime,
                                         const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
     void handleQuestionResponseLevel2(sf::Text& text);
     void checkAnswerLevel2(bool playerAnswer, sf::Text& text, bool& enemyTriggered, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
     void handleAscentAndCleanupLevel2(std::unique_ptr<Enemy>& enemy, sf::Text& text, bool& enemyTriggered, ButtonInteraction& buttonInteraction, float deltaTime);
 
-    void handleInitialInteractionLevel3(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+    void handleInitialInteractionLevel3(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                         std::unique_ptr<Enemy>& enemy, float deltaTime,
                                         const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel);
     void handleQuestionResponseLevel3(sf::Text& text);
@@ -183,7 +182,6 @@ private:
                                       ButtonInteraction& buttonInteraction, float deltaTime);
 
     void spawnGems();
-    void handleOrbs(float deltaTime, const sf::Vector2f& playerPos);
     void spawnOrbPattern(std::unique_ptr<Enemy>& enemy);
     void spawnSpiralOrbs(std::unique_ptr<Enemy>& enemy);
     void spawnShotgunOrbs(std::unique_ptr<Enemy>& enemy);
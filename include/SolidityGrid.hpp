@@ -0,0 +1,41 @@
+#ifndef SOLIDITY_GRID_HPP
+#define SOLIDITY_GRID_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Two bits per 64px cell: solid if a tile covers the whole cell, partial if
+// tiles only cover part of it (a 64x32 platform, an off-grid prop). Solid
+// cells answer from the bit alone; partial cells keep the boxes touching them
+// and test those exactly, so the result matches intersecting every tile.
+class SolidityGrid {
+public:
+    explicit SolidityGrid(float cellSize = 64.0f);
+
+    void build(const std::vector<sf::FloatRect>& solidBoxes);
+    void clear();
+
+    bool isSolidCell(int cellX, int cellY) const;
+    bool overlapsSolid(const sf::FloatRect& area) const;
+
+private:
+    float cellSize;
+    int originX{0}, originY{0};
+    int width{0}, height{0};
+    std::vector<std::uint64_t> solidBits;
+    std::vector<std::uint64_t> partialBits;
+    std::vector<sf::FloatRect> boxes;
+    std::unordered_map<std::size_t, std::vector<std::uint32_t>> partialCells;  // cell index -> boxes
+
+    std::size_t cellIndex(int cellX, int cellY) const;
+    static bool testBit(const std::vector<std::uint64_t>& bits, std::size_t index) {
+        return (bits[index / 64] >> (index % 64)) & 1;
+    }
+
+    int toCell(float coordinate) const;
+    int toLastCell(float coordinate) const;
+};
+
+#endif // SOLIDITY_GRID_HPP
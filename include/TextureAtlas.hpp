@@ -0,0 +1,47 @@
+#ifndef TEXTURE_ATLAS_HPP
+#define TEXTURE_ATLAS_HPP
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AssetType.hpp"
+
+// Packs every tile/prop texture into one (or, if they don't fit, a few) atlas
+// pages at startup. Anything drawn from the atlas shares a texture, so tiles,
+// platforms and props can all go out in the same batch.
+class TextureAtlas {
+public:
+    explicit TextureAtlas(unsigned pageSize = 1024, unsigned padding = 2);
+
+    bool loadFromFiles(const std::vector<std::pair<AssetType, std::string>>& files);
+    // Packs images that were already decoded (e.g. by AssetLoader); only the page upload happens here.
+    // Without upload only the layout is computed: sizes and rects are known
+    // but there are no pages, which is all a headless run needs.
+    bool loadFromImages(const std::vector<std::pair<AssetType, const sf::Image*>>& images, bool upload = true);
+
+    bool contains(AssetType type) const;
+    std::size_t getPage(AssetType type) const;
+    sf::IntRect getTextureRect(AssetType type) const;
+    sf::Vector2f getSize(AssetType type) const;
+
+    const sf::Texture& getTexture(std::size_t page) const { return *pages[page]; }
+    std::size_t getPageCount() const { return pages.size(); }
+
+private:
+    struct Region {
+        bool loaded{false};
+        std::size_t page{0};
+        sf::IntRect rect;
+    };
+
+    unsigned pageSize;
+    unsigned padding;
+    std::vector<Region> regions;  // indexed by AssetType value
+    std::vector<std::unique_ptr<sf::Texture>> pages;
+
+    const Region* findRegion(AssetType type) const;
+};
+
+#endif // TEXTURE_ATLAS_HPP
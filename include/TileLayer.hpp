@@ -0,0 +1,60 @@
+#ifndef TILE_LAYER_HPP
+#define TILE_LAYER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "AssetType.hpp"
+#include "TextureAtlas.hpp"
+#include "TileMap.hpp"
+
+// Render cache over a TileMap, one entry per TileMap chunk. Each chunk bakes its
+// tiles into one vertex array per atlas page, so a visible chunk costs one draw
+// call per page instead of one sprite per tile.
+//
+// Vertices only exist for chunks near the camera: updateResidency() builds them
+// from the tile map as chunks come into range and frees them once they fall
+// well behind, and draw() skips resident chunks outside the view. Memory and
+// draw time follow the visible area rather than the size of the level.
+class TileLayer {
+public:
+    static constexpr int CHUNK_CELLS = TileMap::CHUNK_CELLS;
+
+    explicit TileLayer(float cellSize = 64.0f);
+
+    // Forgets every resident chunk; they are rebuilt from the map on demand.
+    void reset(const TextureAtlas& atlas);
+    void clear();
+
+    // Makes chunks overlapping area (plus a chunk of margin) resident and
+    // releases those more than two chunks away from it.
+    void updateResidency(const TileMap& tileMap, const sf::FloatRect& area);
+    // Drops the chunk holding an edited cell; the next updateResidency()
+    // rebuilds it, once however many of its cells changed.
+    void invalidateCell(int cellX, int cellY);
+    void draw(sf::RenderWindow& window) const;
+
+    std::size_t getResidentChunkCount() const { return residentChunks.size(); }
+
+private:
+    struct Batch {
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    struct Chunk {
+        sf::FloatRect bounds;  // includes tiles hanging past the chunk edge
+        std::vector<Batch> batches;  // empty if the chunk has no tiles
+    };
+
+    float chunkSize;
+    const TextureAtlas* atlas{nullptr};
+    std::unordered_map<GridKey, Chunk> residentChunks;
+
+    void buildChunk(const TileMap& tileMap, int chunkX, int chunkY, Chunk& chunk) const;
+    void appendQuad(Chunk& chunk, const sf::Vector2f& position, AssetType type) const;
+    int toChunk(float coordinate) const;
+};
+
+#endif // TILE_LAYER_HPP
@@ -0,0 +1,130 @@
+#ifndef TILE_MAP_HPP
+#define TILE_MAP_HPP
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "AssetType.hpp"
+#include "GridKey.hpp"
+
+// The level's tiles as 16-bit IDs (the AssetType value, 0 for empty) in dense
+// CHUNK_CELLS x CHUNK_CELLS blocks of editor cells, so a tile costs two bytes
+// and neighbouring cells sit next to each other in memory. Only chunks that
+// hold a tile are allocated.
+//
+// Tiles that don't fit the grid (off-grid positions, or a second tile stacked
+// in an occupied cell) go in a small props side table instead.
+class TileMap {
+public:
+    using TileId = std::uint16_t;
+    static constexpr TileId EMPTY = 0;
+    static constexpr int CHUNK_CELLS = 32;
+
+    struct Chunk {
+        std::array<TileId, CHUNK_CELLS * CHUNK_CELLS> ids{};  // row-major
+        int tileCount{0};
+    };
+
+    struct Prop {
+        sf::Vector2f position;
+        AssetType type;
+    };
+
+    explicit TileMap(float cellSize = 64.0f);
+
+    void build(const std::vector<std::pair<sf::Vector2f, AssetType>>& tiles);
+    void clear();
+    // Back to the list form the level files use
+    std::vector<std::pair<sf::Vector2f, AssetType>> toTileList() const;
+
+    TileId get(int cellX, int cellY) const;
+    // Both return false if the cell was already in that state
+    bool set(int cellX, int cellY, AssetType type);
+    bool erase(int cellX, int cellY);
+
+    // Calls visit(position, type) for every grid tile anchored in cells (and
+    // every prop whose position falls inside them), chunk by chunk.
+    template <typename Visitor>
+    void forEachTileIn(const sf::IntRect& cells, Visitor&& visit) const;
+    template <typename Visitor>
+    void forEachTile(Visitor&& visit) const;
+
+    const Chunk* findChunk(int chunkX, int chunkY) const;
+    const std::vector<Prop>& getProps() const { return props; }
+
+    sf::Vector2i toCell(const sf::Vector2f& position) const;
+    float getCellSize() const { return cellSize; }
+    std::size_t getTileCount() const { return tileCount + props.size(); }
+    std::size_t getChunkCount() const { return chunks.size(); }
+    std::size_t getMemoryBytes() const;
+
+    // Union of the cells holding a tile; empty if there are none. It grows
+    // with set() but isn't shrunk by erase() until the next build().
+    const sf::FloatRect& getCellBounds() const { return cellBounds; }
+
+    static GridKey chunkKey(int chunkX, int chunkY) { return gridKey(chunkX, chunkY); }
+    static int toChunk(int cell) {
+        return cell >= 0 ? cell / CHUNK_CELLS : (cell + 1) / CHUNK_CELLS - 1;
+    }
+
+private:
+    float cellSize;
+    std::unordered_map<GridKey, Chunk> chunks;
+    std::vector<Prop> props;
+    std::size_t tileCount{0};
+    sf::FloatRect cellBounds;
+
+    void growCellBounds(int cellX, int cellY);
+};
+
+template <typename Visitor>
+void TileMap::forEachTileIn(const sf::IntRect& cells, Visitor&& visit) const {
+    int lastX = cells.left + cells.width - 1;
+    int lastY = cells.top + cells.height - 1;
+    for (int chunkY = toChunk(cells.top); chunkY <= toChunk(lastY); ++chunkY) {
+        for (int chunkX = toChunk(cells.left); chunkX <= toChunk(lastX); ++chunkX) {
+            const Chunk* chunk = findChunk(chunkX, chunkY);
+            if (!chunk) continue;
+
+            int firstCellX = chunkX * CHUNK_CELLS;
+            int firstCellY = chunkY * CHUNK_CELLS;
+            int fromY = std::max(cells.top, firstCellY), toY = std::min(lastY, firstCellY + CHUNK_CELLS - 1);
+            int fromX = std::max(cells.left, firstCellX), toX = std::min(lastX, firstCellX + CHUNK_CELLS - 1);
+            for (int cellY = fromY; cellY <= toY; ++cellY) {
+                const TileId* row = &chunk->ids[(cellY - firstCellY) * CHUNK_CELLS];
+                for (int cellX = fromX; cellX <= toX; ++cellX) {
+                    TileId id = row[cellX - firstCellX];
+                    if (id != EMPTY) visit(sf::Vector2f(cellX * cellSize, cellY * cellSize), static_cast<AssetType>(id));
+                }
+            }
+        }
+    }
+
+    for (const auto& prop : props) {
+        if (cells.contains(toCell(prop.position))) visit(prop.position, prop.type);
+    }
+}
+
+template <typename Visitor>
+void TileMap::forEachTile(Visitor&& visit) const {
+    for (const auto& entry : chunks) {
+        int firstCellX = gridKeyX(entry.first) * CHUNK_CELLS;
+        int firstCellY = gridKeyY(entry.first) * CHUNK_CELLS;
+        for (int i = 0; i < CHUNK_CELLS * CHUNK_CELLS; ++i) {
+            TileId id = entry.second.ids[i];
+            if (id == EMPTY) continue;
+            visit(sf::Vector2f((firstCellX + i % CHUNK_CELLS) * cellSize, (firstCellY + i / CHUNK_CELLS) * cellSize),
+                  static_cast<AssetType>(id));
+        }
+    }
+    for (const auto& prop : props) {
+        visit(prop.position, prop.type);
+    }
+}
+
+#endif // TILE_MAP_HPP
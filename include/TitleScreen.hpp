@@ -2,6 +2,7 @@
 #define TITLESCREEN_HPP
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include "Background.hpp"  
 
 class TitleScreen {
@@ -16,7 +17,7 @@ public:
 
 private:
     sf::RenderWindow& window;
-    sf::Font font;
+    std::shared_ptr<sf::Font> font;
     sf::Text gameTitle;
     sf::Text menuOptions[3];
     sf::Texture backgroundTexture;
@@ -0,0 +1,105 @@
+#ifndef TRACE_RECORDER_HPP
+#define TRACE_RECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Records timed events from any thread and writes them as a Chrome trace
+// (chrome://tracing, ui.perfetto.dev). Each event is one complete ("X") event,
+// carrying its begin time and duration.
+//
+// Every thread appends to its own fixed-size buffer, so recording takes no
+// lock and never allocates after a thread's first event. The count is
+// published with a release store, and stop() only reads events that were
+// fully written. The lock is only taken when a thread records its first
+// event, and by start() and stop().
+//
+// Event names must be string literals (or otherwise outlive the recording).
+class TraceRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t EVENTS_PER_THREAD = 1 << 15;
+
+    static TraceRecorder& get();
+
+    void start();
+    // Stops recording and writes everything recorded since start() to path.
+    bool stop(const std::string& path);
+    bool isRecording() const { return recording.load(std::memory_order_acquire); }
+
+    void record(const char* name, Clock::time_point begin, Clock::time_point end);
+
+private:
+    struct Event {
+        const char* name;
+        std::int64_t beginUs;
+        std::int64_t durationUs;
+    };
+
+    struct ThreadBuffer {
+        unsigned threadId{0};
+        bool retired{false};  // its thread has exited; guarded by buffersMutex
+        std::atomic<unsigned> session{0};  // the recording its events belong to
+        std::unique_ptr<Event[]> events{new Event[EVENTS_PER_THREAD]};
+        std::atomic<std::size_t> count{0};
+        std::atomic<std::size_t> dropped{0};
+    };
+
+    // Hands the thread's buffer back when the thread exits
+    struct ThreadSlot {
+        ThreadBuffer* buffer{nullptr};
+        ~ThreadSlot();
+    };
+
+    std::atomic<bool> recording{false};
+    std::atomic<unsigned> session{0};
+    std::atomic<Clock::rep> sessionStart{0};
+
+    std::mutex buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    unsigned nextThreadId{1};
+
+    ThreadBuffer& threadBuffer();
+};
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name(name) {
+        if (TraceRecorder::get().isRecording()) begin = TraceRecorder::Clock::now();
+    }
+    ~TraceScope() {
+        if (begin != TraceRecorder::Clock::time_point()) {
+            TraceRecorder::get().record(name, begin, TraceRecorder::Clock::now());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    TraceRecorder::Clock::time_point begin{};
+};
+
+#ifndef VEX_PROFILING
+#define VEX_PROFILING 0
+#endif
+
+#define VEX_TRACE_CONCAT_INNER(a, b) a##b
+#define VEX_TRACE_CONCAT(a, b) VEX_TRACE_CONCAT_INNER(a, b)
+
+// Trace-only scope for work outside the per-frame profiler zones (loads, decodes)
+#if VEX_PROFILING
+#define VEX_TRACE_SCOPE(name) TraceScope VEX_TRACE_CONCAT(traceScope, __LINE__)(name)
+#else
+#define VEX_TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif // TRACE_RECORDER_HPP
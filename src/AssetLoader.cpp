@@ -0,0 +1,117 @@
+#include "../include/AssetLoader.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/TraceRecorder.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+float millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+AssetLoader::AssetLoader(unsigned workerCount) : workerCount(std::max(1u, workerCount)) {}
+
+void AssetLoader::addTexture(const std::string& path) {
+    add(path, true);
+}
+
+void AssetLoader::addImage(const std::string& path) {
+    add(path, false);
+}
+
+void AssetLoader::add(const std::string& path, bool upload) {
+    // The same file can be queued by several users (e.g. a background layer
+    // shared between levels); decode it once and upload it if anyone wants that.
+    for (auto& job : jobs) {
+        if (job.path == path) {
+            job.upload = job.upload || upload;
+            return;
+        }
+    }
+    Job job;
+    job.path = path;
+    job.upload = upload;
+    jobs.push_back(job);
+}
+
+bool AssetLoader::run() {
+    auto start = std::chrono::steady_clock::now();
+
+    // Workers pull the next undecoded job until the queue runs dry. Each job is
+    // only touched by the worker that claimed it until join().
+    std::atomic<std::size_t> nextJob{0};
+    auto decode = [&]() {
+        for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+            Job& job = jobs[i];
+            if (job.decoded) continue;
+            VEX_TRACE_SCOPE("Decode image");
+            auto decodeStart = std::chrono::steady_clock::now();
+            job.decoded = job.image.loadFromFile(job.path);
+            job.decodeMs = millisecondsSince(decodeStart);
+        }
+    };
+
+    unsigned threadCount = static_cast<unsigned>(std::min<std::size_t>(workerCount, jobs.size()));
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < threadCount; ++i) {
+        workers.emplace_back(decode);
+    }
+    decode();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    bool allLoaded = true;
+    for (auto& job : jobs) {
+        if (!job.decoded) {
+            std::cerr << "Error loading image from " << job.path << std::endl;
+            allLoaded = false;
+            continue;
+        }
+        if (!job.upload) continue;
+
+        VEX_TRACE_SCOPE("Upload texture");
+        auto uploadStart = std::chrono::steady_clock::now();
+        pinned.push_back(ResourceCache::get().addTexture(job.path, job.image));
+        job.uploadMs = millisecondsSince(uploadStart);
+        job.image = sf::Image();  // the texture holds the pixels now
+    }
+
+    wallMs = millisecondsSince(start);
+    return allLoaded;
+}
+
+const sf::Image* AssetLoader::getImage(const std::string& path) const {
+    for (const auto& job : jobs) {
+        if (job.path == path && job.decoded) return &job.image;
+    }
+    return nullptr;
+}
+
+void AssetLoader::releaseImages() {
+    for (auto& job : jobs) {
+        if (!job.upload) job.image = sf::Image();
+    }
+}
+
+void AssetLoader::printReport(std::ostream& out) const {
+    float decodeTotal = 0.0f;
+    float uploadTotal = 0.0f;
+
+    out << "Startup assets:\n" << std::fixed << std::setprecision(2);
+    for (const auto& job : jobs) {
+        out << "  decode " << std::setw(7) << job.decodeMs << " ms  upload " << std::setw(6) << job.uploadMs << " ms  "
+            << job.path << (job.decoded ? "" : "  (failed)") << "\n";
+        decodeTotal += job.decodeMs;
+        uploadTotal += job.uploadMs;
+    }
+    out << "  " << jobs.size() << " files in " << wallMs << " ms (" << decodeTotal << " ms decode on up to "
+        << std::min<std::size_t>(workerCount, jobs.size()) << " threads, " << uploadTotal << " ms upload)"
+        << std::defaultfloat << std::endl;
+}
@@ -1,47 +1,74 @@
 #include "../include/Background.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/Profiler.hpp"
 #include <iostream>
 #include <cmath>
 
 Background::Background(const std::string& backgroundFilePath, const std::string& middlegroundFilePath, const std::string& mountainsFilePath, const sf::Vector2u& windowSize) {
+    // Shared with every other Background using the same layers (the title screen
+    // and level 1 both use the tutorial set), so the repeat flag is set once here.
+    backgroundTexture = ResourceCache::get().getTexture(backgroundFilePath);
+    backgroundTexture->setRepeated(true);
+    backgroundSprite.setTexture(*backgroundTexture);
 
-    if (!backgroundTexture.loadFromFile(backgroundFilePath)) {
-        std::cerr << "Error loading background texture from " << backgroundFilePath << std::endl;
-    }
-    backgroundSprite.setTexture(backgroundTexture);
+    middlegroundTexture = ResourceCache::get().getTexture(middlegroundFilePath);
+    mountainsTexture = ResourceCache::get().getTexture(mountainsFilePath);
+    middlegroundTexture->setRepeated(true);
 
-    if (!middlegroundTexture.loadFromFile(middlegroundFilePath)) {
-        std::cerr << "Error loading middleground texture from " << middlegroundFilePath << std::endl;
-    }
+    middlegroundSprite.setTextureRect(sf::IntRect(0, 0, windowSize.x, middlegroundTexture->getSize().y));
 
-    if (!mountainsTexture.loadFromFile(mountainsFilePath)) {
-        std::cerr << "Error loading mountains texture from " << mountainsFilePath << std::endl;
-    }
-    middlegroundTexture.setRepeated(true);
+    middlegroundSprite.setTexture(*middlegroundTexture);
+
+    mountainsTexture->setRepeated(true);
 
-    middlegroundSprite.setTextureRect(sf::IntRect(0, 0, windowSize.x, middlegroundTexture.getSize().y));
+    mountainsSprite.setTextureRect(sf::IntRect(0, 0, windowSize.x, mountainsTexture->getSize().y));
 
-    middlegroundSprite.setTexture(middlegroundTexture);
+    mountainsSprite.setTexture(*mountainsTexture);
 
-    mountainsTexture.setRepeated(true);
+    backgroundVertices.setPrimitiveType(sf::Quads);
+    backgroundVertices.resize(4);
+    mountainsVertices.setPrimitiveType(sf::Quads);
+    mountainsVertices.resize(4);
+    middlegroundVertices.setPrimitiveType(sf::Quads);
+    middlegroundVertices.resize(4);
 
-    mountainsSprite.setTextureRect(sf::IntRect(0, 0, windowSize.x, mountainsTexture.getSize().y));
+    setLayerSizes(backgroundTexture->getSize(), middlegroundTexture->getSize(), mountainsTexture->getSize());
+}
 
-    mountainsSprite.setTexture(mountainsTexture);
+void Background::setLayerSizes(const sf::Vector2u& background, const sf::Vector2u& middleground, const sf::Vector2u& mountains) {
+    backgroundSize = sf::Vector2f(background);
+    middlegroundSize = sf::Vector2f(middleground);
+    mountainsSize = sf::Vector2f(mountains);
 }
 
 void Background::render(sf::RenderWindow& window, const sf::Vector2u& windowSize, float playerX, float deltaTime) {
+    VEX_PROFILE_SCOPE(Background);
+
+    buildVertices(windowSize, playerX, deltaTime);
 
-    backgroundTexture.setRepeated(true);
+    sf::RenderStates bgStates;
+    bgStates.texture = backgroundTexture.get();
+    window.draw(backgroundVertices, bgStates);
+
+    sf::RenderStates mountStates;
+    mountStates.texture = mountainsTexture.get();
+    window.draw(mountainsVertices, mountStates);
+
+    sf::RenderStates mgStates;
+    mgStates.texture = middlegroundTexture.get();
+    window.draw(middlegroundVertices, mgStates);
+}
 
+void Background::buildVertices(const sf::Vector2u& windowSize, float playerX, float deltaTime) {
     float backgroundParallaxFactor = 0.01f;
 
     float backgroundOffsetX = playerX * backgroundParallaxFactor;
 
-    float backgroundTextureWidth = static_cast<float>(backgroundTexture.getSize().x);
+    float backgroundTextureWidth = backgroundSize.x;
     backgroundOffsetX = fmod(backgroundOffsetX, backgroundTextureWidth);
     if (backgroundOffsetX < 0) backgroundOffsetX += backgroundTextureWidth;
 
-    float backgroundTextureHeight = static_cast<float>(backgroundTexture.getSize().y);
+    float backgroundTextureHeight = backgroundSize.y;
     float backgroundAspectRatio = backgroundTextureWidth / backgroundTextureHeight;
     float windowAspectRatio = static_cast<float>(windowSize.x) / windowSize.y;
 
@@ -52,8 +79,6 @@ void Background::render(sf::RenderWindow& window, const sf::Vector2u& windowSize
         backgroundScale = static_cast<float>(windowSize.x) / backgroundTextureWidth;
     }
 
-    sf::VertexArray backgroundVertices(sf::Quads, 4);
-
     backgroundVertices[0].position = sf::Vector2f(0.0f, 0.0f);
     backgroundVertices[1].position = sf::Vector2f(static_cast<float>(windowSize.x), 0.0f);
     backgroundVertices[2].position = sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y));
@@ -67,28 +92,19 @@ void Background::render(sf::RenderWindow& window, const sf::Vector2u& windowSize
     backgroundVertices[2].texCoords = sf::Vector2f(texCoordOffsetX + texCoordWidth, backgroundTextureHeight);
     backgroundVertices[3].texCoords = sf::Vector2f(texCoordOffsetX, backgroundTextureHeight);
 
-    sf::RenderStates bgStates;
-    bgStates.texture = &backgroundTexture;
-    window.draw(backgroundVertices, bgStates);
-
-    mountainsTexture.setRepeated(true);
-
     float mountainsParallaxFactor = 0.1f;
-    static float mountainsScrollOffset = 0.0f;
     float mountainsScrollSpeed = 4.0f;
 
     mountainsScrollOffset += mountainsScrollSpeed * deltaTime;
 
     float mountainsOffsetX = playerX * mountainsParallaxFactor + mountainsScrollOffset;
 
-    float mountainsTextureWidth = static_cast<float>(mountainsTexture.getSize().x);
-    float mountainsTextureHeight = static_cast<float>(mountainsTexture.getSize().y);
+    float mountainsTextureWidth = mountainsSize.x;
+    float mountainsTextureHeight = mountainsSize.y;
 
     float desiredMountainsHeight = windowSize.y * 0.5f;
     float mountainsScale = desiredMountainsHeight / mountainsTextureHeight;
 
-    sf::VertexArray mountainsVertices(sf::Quads, 4);
-
     float mountainsPositionY = windowSize.y - desiredMountainsHeight - 100.0f;
 
     mountainsVertices[0].position = sf::Vector2f(0.0f, mountainsPositionY);
@@ -108,28 +124,19 @@ void Background::render(sf::RenderWindow& window, const sf::Vector2u& windowSize
     mountainsVertices[2].texCoords = sf::Vector2f(mTexCoordOffsetX + mTexCoordWidth, mountainsTextureHeight);
     mountainsVertices[3].texCoords = sf::Vector2f(mTexCoordOffsetX, mountainsTextureHeight);
 
-    sf::RenderStates mountStates;
-    mountStates.texture = &mountainsTexture;
-    window.draw(mountainsVertices, mountStates);
-
-    middlegroundTexture.setRepeated(true);
-
     float middlegroundParallaxFactor = 0.3f;
-    static float middlegroundScrollOffset = 0.0f;
     float middlegroundScrollSpeed = 2.0f;
 
     middlegroundScrollOffset += middlegroundScrollSpeed * deltaTime;
 
     float middlegroundOffsetX = playerX * middlegroundParallaxFactor + middlegroundScrollOffset;
 
-    float middlegroundTextureWidth = static_cast<float>(middlegroundTexture.getSize().x);
-    float middlegroundTextureHeight = static_cast<float>(middlegroundTexture.getSize().y);
+    float middlegroundTextureWidth = middlegroundSize.x;
+    float middlegroundTextureHeight = middlegroundSize.y;
 
     float desiredMiddlegroundHeight = windowSize.y * 0.5f;
     float middlegroundScale = desiredMiddlegroundHeight / middlegroundTextureHeight;
 
-    sf::VertexArray middlegroundVertices(sf::Quads, 4);
-
     float middlegroundPositionY = windowSize.y - desiredMiddlegroundHeight - 1.0f;
 
     middlegroundVertices[0].position = sf::Vector2f(0.0f, middlegroundPositionY);
@@ -148,9 +155,4 @@ void Background::render(sf::RenderWindow& window, const sf::Vector2u& windowSize
     middlegroundVertices[1].texCoords = sf::Vector2f(textureCoordOffsetX + textureCoordWidth, 0.0f);
     middlegroundVertices[2].texCoords = sf::Vector2f(textureCoordOffsetX + textureCoordWidth, middlegroundTextureHeight);
     middlegroundVertices[3].texCoords = sf::Vector2f(textureCoordOffsetX, middlegroundTextureHeight);
-
-    sf::RenderStates mgStates;
-    mgStates.texture = &middlegroundTexture;
-    window.draw(middlegroundVertices, mgStates);
 }
-
@@ -1,28 +1,28 @@
 // ButtonInteraction.cpp
 
 #include "../include/ButtonInteraction.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/Input.hpp"
 
 bool resetSentinelInteraction = false;
 
 ButtonInteraction::ButtonInteraction()
-    : showingText(false), promptVisible(true), displayDuration(3),
-      timerStart(std::chrono::steady_clock::now()), interactionInProgress(false) {
-    if (!font.loadFromFile("assets/fonts/Merriweather-Regular.ttf")) {
-        std::cerr << "Failed to load font\n";
-    }
-    text.setFont(font);
+    : showingText(false), promptVisible(true), textVisible(false), displayDuration(3.0f),
+      displayTimer(0.0f), interactionInProgress(false) {
+    font = ResourceCache::get().getFont("assets/fonts/Merriweather-Regular.ttf");
+    text.setFont(*font);
     text.setCharacterSize(24);
     text.setFillColor(sf::Color::White);
 }
 
 void ButtonInteraction::handleInteraction(const sf::Vector2f& playerPos,
-                                          const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions,
-                                          sf::RenderWindow& window, bool& enemyTriggered, bool& enemyDescending,
-                                          bool& enemySpawned) {
+                                          const TileMap& tileMap,
+                                          bool& enemyTriggered, bool& enemyDescending,
+                                          bool& enemySpawned, float deltaTime) {
     bool nearButton = false;
 
-    for (const auto& tile : tilePositions) {
-        if (tile.second == AssetType::Button && distance(playerPos, tile.first) < 100.0f) {
+    tileMap.forEachTileIn(cellsNear(tileMap, playerPos), [&](const sf::Vector2f& buttonPos, AssetType type) {
+        if (type == AssetType::Button && distance(playerPos, buttonPos) < INTERACTION_RADIUS) {
             nearButton = true;
             if (promptVisible && !interactionInProgress) {
                 if (!enemySpawned) {
@@ -33,8 +33,8 @@ void ButtonInteraction::handleInteraction(const sf::Vector2f& playerPos,
                 text.setPosition(playerPos.x, playerPos.y - 50);
             }
 
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::F) && !interactionInProgress) {
-                timerStart = std::chrono::steady_clock::now();
+            if (isKeyPressed(sf::Keyboard::F) && !interactionInProgress) {
+                displayTimer = 0.0f;
                 showingText = true;
                 promptVisible = false;
                 enemyTriggered = true;
@@ -46,39 +46,36 @@ void ButtonInteraction::handleInteraction(const sf::Vector2f& playerPos,
                 resetSentinelInteraction = true;
             }
         }
-    }
+    });
 
     if (showingText) {
-        auto now = std::chrono::steady_clock::now();
-        float elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - timerStart).count();
-        if (elapsed >= displayDuration) {
+        displayTimer += deltaTime;
+        if (displayTimer >= displayDuration) {
             showingText = false;
         }
     }
 
-    if ((nearButton && promptVisible) || showingText) {
-        window.draw(text);
-    }
+    textVisible = (nearButton && promptVisible) || showingText;
 }
 
 void ButtonInteraction::handleInteractionLevel2(const sf::Vector2f& playerPos, 
-                                              const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions,
-                                              sf::RenderWindow& window, bool& enemyTriggered, 
-                                              bool& enemyDescending, bool& sentinelDescendLevel2) {
+                                              const TileMap& tileMap,
+                                              bool& enemyTriggered, 
+                                              bool& enemyDescending, bool& sentinelDescendLevel2,
+                                              float deltaTime) {
     bool nearButton = false;
 
-    for (const auto& tile : tilePositions) {
-        if (tile.second == AssetType::Button) {
-            sf::Vector2f buttonPos = tile.first;
-            if (distance(playerPos, buttonPos) < 100.0f) {
+    tileMap.forEachTileIn(cellsNear(tileMap, playerPos), [&](const sf::Vector2f& buttonPos, AssetType type) {
+        if (type == AssetType::Button) {
+            if (distance(playerPos, buttonPos) < INTERACTION_RADIUS) {
                 nearButton = true;
                 if (promptVisible && !interactionInProgress) {
                     text.setString("Press F to prompt the sentinel...");
                     text.setPosition(buttonPos.x - 50, buttonPos.y - 50);
                 }
 
-                if (sf::Keyboard::isKeyPressed(sf::Keyboard::F) && !interactionInProgress) {
-                    timerStart = std::chrono::steady_clock::now();
+                if (isKeyPressed(sf::Keyboard::F) && !interactionInProgress) {
+                    displayTimer = 0.0f;
                     showingText = true;
                     promptVisible = false;
                     enemyTriggered = true;
@@ -91,43 +88,40 @@ void ButtonInteraction::handleInteractionLevel2(const sf::Vector2f& playerPos,
                 }
             }
         }
-    }
+    });
 
     if (showingText) {
-        auto now = std::chrono::steady_clock::now();
-        float elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - timerStart).count();
-        if (elapsed >= displayDuration) {
+        displayTimer += deltaTime;
+        if (displayTimer >= displayDuration) {
             showingText = false;
         }
     }
 
-    if ((nearButton && promptVisible) || showingText) {
-        window.draw(text);
-    }
+    textVisible = (nearButton && promptVisible) || showingText;
 }
 
 void ButtonInteraction::handleInteractionLevel3(const sf::Vector2f& playerPos, 
-                                              const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions,
-                                              sf::RenderWindow& window, bool& enemyTriggered, 
-                                              bool& enemyDescending, bool& sentinelDescendLevel3) {
+                                              const TileMap& tileMap,
+                                              bool& enemyTriggered, 
+                                              bool& enemyDescending, bool& sentinelDescendLevel3,
+                                              float deltaTime) {
     bool nearButton = false;
 
-    for (const auto& tile : tilePositions) {
-        if (tile.second == AssetType::Button) {
-            sf::Vector2f buttonPos = tile.first;
+    tileMap.forEachTileIn(cellsNear(tileMap, playerPos), [&](const sf::Vector2f& buttonPos, AssetType type) {
+        if (type == AssetType::Button) {
             // Use the same distance check as other levels
-            if (distance(playerPos, buttonPos) < 100.0f) {
+            if (distance(playerPos, buttonPos) < INTERACTION_RADIUS) {
                 nearButton = true;
                 if (promptVisible && !interactionInProgress) {
                     text.setString("Press F...");  // Make consistent with other levels
                     text.setPosition(buttonPos.x - 50, buttonPos.y - 50);
                 }
 
-                if (sf::Keyboard::isKeyPressed(sf::Keyboard::F) && !interactionInProgress) {
+                if (isKeyPressed(sf::Keyboard::F) && !interactionInProgress) {
                     // Debug output to verify the button press
                     std::cout << "Level 3 button pressed\n";
                     
-                    timerStart = std::chrono::steady_clock::now();
+                    displayTimer = 0.0f;
                     showingText = true;
                     promptVisible = false;
                     
@@ -147,19 +141,20 @@ void ButtonInteraction::handleInteractionLevel3(const sf::Vector2f& playerPos,
                 }
             }
         }
-    }
+    });
 
     if (showingText) {
-        auto now = std::chrono::steady_clock::now();
-        float elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - timerStart).count();
-        if (elapsed >= displayDuration) {
+        displayTimer += deltaTime;
+        if (displayTimer >= displayDuration) {
             showingText = false;
         }
     }
 
-    if ((nearButton && promptVisible) || showingText) {
-        window.draw(text);
-    }
+    textVisible = (nearButton && promptVisible) || showingText;
+}
+
+void ButtonInteraction::draw(sf::RenderWindow& window) const {
+    if (textVisible) window.draw(text);
 }
 
 void ButtonInteraction::resetAllFlags() {
@@ -173,6 +168,12 @@ void ButtonInteraction::resetPrompt() {
     interactionInProgress = false;
 }
 
+sf::IntRect ButtonInteraction::cellsNear(const TileMap& tileMap, const sf::Vector2f& position) {
+    sf::Vector2i first = tileMap.toCell(position - sf::Vector2f(INTERACTION_RADIUS, INTERACTION_RADIUS));
+    sf::Vector2i last = tileMap.toCell(position + sf::Vector2f(INTERACTION_RADIUS, INTERACTION_RADIUS));
+    return sf::IntRect(first, last - first + sf::Vector2i(1, 1));
+}
+
 float ButtonInteraction::distance(const sf::Vector2f& a, const sf::Vector2f& b) {
     return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
 }
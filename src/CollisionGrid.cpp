@@ -0,0 +1,136 @@
+#include "../include/CollisionGrid.hpp"
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+CollisionGrid::CollisionGrid(float cellSize) : cellSize(cellSize) {}
+
+void CollisionGrid::build(const std::vector<sf::FloatRect>& solidBoxes) {
+    clear();
+    boxes = solidBoxes;
+
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        link(static_cast<std::uint32_t>(i));
+    }
+}
+
+std::vector<sf::FloatRect> CollisionGrid::mergeBoxes(std::vector<sf::FloatRect> solidBoxes) {
+    if (solidBoxes.empty()) return solidBoxes;
+
+    // Rows: boxes with the same top and height that touch or overlap horizontally
+    std::sort(solidBoxes.begin(), solidBoxes.end(), [](const sf::FloatRect& a, const sf::FloatRect& b) {
+        return std::tie(a.top, a.height, a.left) < std::tie(b.top, b.height, b.left);
+    });
+
+    std::vector<sf::FloatRect> rows;
+    rows.push_back(solidBoxes.front());
+    for (std::size_t i = 1; i < solidBoxes.size(); ++i) {
+        const sf::FloatRect& box = solidBoxes[i];
+        sf::FloatRect& run = rows.back();
+        if (box.top == run.top && box.height == run.height && box.left <= run.left + run.width) {
+            run.width = std::max(run.left + run.width, box.left + box.width) - run.left;
+        } else {
+            rows.push_back(box);
+        }
+    }
+
+    // Columns: row runs with the same left and width stacked directly on top of each other
+    std::sort(rows.begin(), rows.end(), [](const sf::FloatRect& a, const sf::FloatRect& b) {
+        return std::tie(a.left, a.width, a.top) < std::tie(b.left, b.width, b.top);
+    });
+
+    std::vector<sf::FloatRect> merged;
+    merged.push_back(rows.front());
+    for (std::size_t i = 1; i < rows.size(); ++i) {
+        const sf::FloatRect& row = rows[i];
+        sf::FloatRect& box = merged.back();
+        if (row.left == box.left && row.width == box.width && row.top <= box.top + box.height) {
+            box.height = std::max(box.top + box.height, row.top + row.height) - box.top;
+        } else {
+            merged.push_back(row);
+        }
+    }
+
+    return merged;
+}
+
+void CollisionGrid::insert(const sf::FloatRect& box) {
+    boxes.push_back(box);
+    link(static_cast<std::uint32_t>(boxes.size() - 1));
+}
+
+std::vector<sf::FloatRect> CollisionGrid::extract(const sf::FloatRect& area) {
+    std::vector<std::uint32_t> hits;
+    CellRange range = cellRange(area);
+    for (int cellY = range.minY; cellY <= range.maxY; ++cellY) {
+        for (int cellX = range.minX; cellX <= range.maxX; ++cellX) {
+            auto cellIt = cells.find(gridKey(cellX, cellY));
+            if (cellIt == cells.end()) continue;
+            for (std::uint32_t index : cellIt->second) {
+                if (boxes[index].intersects(area)) hits.push_back(index);
+            }
+        }
+    }
+
+    // Highest index first, so a swap-remove never moves a box still to be removed
+    std::sort(hits.begin(), hits.end(), std::greater<std::uint32_t>());
+    hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+
+    std::vector<sf::FloatRect> extracted;
+    extracted.reserve(hits.size());
+    for (std::uint32_t index : hits) {
+        extracted.push_back(boxes[index]);
+        removeAt(index);
+    }
+    return extracted;
+}
+
+void CollisionGrid::link(std::uint32_t index) {
+    CellRange range = cellRange(boxes[index]);
+    for (int cellY = range.minY; cellY <= range.maxY; ++cellY) {
+        for (int cellX = range.minX; cellX <= range.maxX; ++cellX) {
+            cells[gridKey(cellX, cellY)].push_back(index);
+        }
+    }
+}
+
+void CollisionGrid::unlink(std::uint32_t index) {
+    CellRange range = cellRange(boxes[index]);
+    for (int cellY = range.minY; cellY <= range.maxY; ++cellY) {
+        for (int cellX = range.minX; cellX <= range.maxX; ++cellX) {
+            auto cellIt = cells.find(gridKey(cellX, cellY));
+            if (cellIt == cells.end()) continue;
+
+            std::vector<std::uint32_t>& indices = cellIt->second;
+            indices.erase(std::remove(indices.begin(), indices.end(), index), indices.end());
+            if (indices.empty()) cells.erase(cellIt);
+        }
+    }
+}
+
+void CollisionGrid::removeAt(std::uint32_t index) {
+    unlink(index);
+
+    std::uint32_t last = static_cast<std::uint32_t>(boxes.size() - 1);
+    if (index != last) {
+        // Re-file the last box under the slot it is moving into
+        unlink(last);
+        boxes[index] = boxes[last];
+        link(index);
+    }
+    boxes.pop_back();
+}
+
+void CollisionGrid::clear() {
+    boxes.clear();
+    cells.clear();
+}
+
+CollisionGrid::CellRange CollisionGrid::cellRange(const sf::FloatRect& area) const {
+    CellRange range;
+    range.minX = static_cast<int>(std::floor(area.left / cellSize));
+    range.minY = static_cast<int>(std::floor(area.top / cellSize));
+    range.maxX = static_cast<int>(std::floor((area.left + area.width) / cellSize));
+    range.maxY = static_cast<int>(std::floor((area.top + area.height) / cellSize));
+    return range;
+}
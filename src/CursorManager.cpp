@@ -0,0 +1,11 @@
+#include "../include/CursorManager.hpp"
+
+CursorManager::CursorManager(sf::Window& window, bool visible) : window(window), visible(visible) {
+    window.setMouseCursorVisible(visible);
+}
+
+void CursorManager::setVisible(bool newVisible) {
+    if (newVisible == visible) return;
+    visible = newVisible;
+    window.setMouseCursorVisible(visible);
+}
@@ -1,5 +1,6 @@
 #include "../include/Enemy.hpp"
-#include "../include/Platform.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/Profiler.hpp"
 #include <iostream>
 
 Enemy::Enemy(float startX, float startY)
@@ -11,8 +12,6 @@ Enemy::Enemy(float startX, float startY)
       speedX(0.0f),
       isFacingRight(true),
       orbCount(0),
-      walkingTexture(),
-      idleTexture(),
       sprite(),
       currentFrame(),
       currentFrameIndex(0),
@@ -22,15 +21,14 @@ Enemy::Enemy(float startX, float startY)
       currentState(EnemyState::IDLE),
       previousState(EnemyState::IDLE)
 {
-    if (!walkingTexture.loadFromFile("assets/characters/enemies/wrathborn_sprite_sheet.png")) {
-        std::cerr << "Error loading walking texture file" << std::endl;
-    }
+    walkingTexture = ResourceCache::get().getTexture("assets/characters/enemies/wrathborn_sprite_sheet.png");
 
-    sprite.setTexture(walkingTexture);
+    sprite.setTexture(*walkingTexture);
     currentFrame = sf::IntRect(0, 0, frameWidth, frameHeight);
     sprite.setTextureRect(currentFrame);
     sprite.setPosition(startX, startY);
     sprite.setScale(4.0f, 4.0f);
+    previousStatePosition = sprite.getPosition();
 }
 
 void Enemy::flipSprite() {
@@ -40,8 +38,10 @@ void Enemy::flipSprite() {
 }
 
 
-void Enemy::update(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight) {
-    (void)platforms;
+void Enemy::update(float deltaTime, const CollisionGrid& collisionGrid, int windowWidth, int windowHeight) {
+    VEX_PROFILE_SCOPE(EnemyUpdate);
+
+    (void)collisionGrid;
     (void)windowWidth;  
     (void)windowHeight;
     animationTimer += deltaTime;
@@ -57,8 +57,10 @@ void Enemy::update(float deltaTime, const std::vector<Platform>& platforms, int
 }
 
 
-void Enemy::draw(sf::RenderWindow& window) const {
-    window.draw(sprite);
+void Enemy::draw(sf::RenderWindow& window, float alpha) const {
+    sf::RenderStates states;
+    states.transform.translate((previousStatePosition - sprite.getPosition()) * (1.0f - alpha));
+    window.draw(sprite, states);
 }
 
 sf::FloatRect Enemy::getGlobalBounds() const {
@@ -69,9 +71,9 @@ bool Enemy::checkCollision(const sf::FloatRect& otherBounds) const {
     return this->getGlobalBounds().intersects(otherBounds);
 }
 
-void Enemy::move(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight) {
+void Enemy::move(float deltaTime, const CollisionGrid& collisionGrid, int windowWidth, int windowHeight) {
     (void)deltaTime;
-    (void)platforms;
+    (void)collisionGrid;
     (void)windowWidth;
     (void)windowHeight;
 }
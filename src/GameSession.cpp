@@ -0,0 +1,275 @@
+#include "../include/GameSession.hpp"
+#include "../include/ResourceCache.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// Story levels in play order; while one is played the next is built in the background
+const char* const LEVEL_PATHS[GameSession::LEVEL_COUNT] = {"levels/level1.txt", "levels/level2.txt", "levels/level3.txt"};
+
+const std::uint64_t FNV_PRIME = 1099511628211ull;
+
+// FNV-1a over the value's bytes; floats are hashed bit for bit
+template <typename T>
+void hashValue(std::uint64_t& hash, const T& value) {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (unsigned char byte : bytes) {
+        hash = (hash ^ byte) * FNV_PRIME;
+    }
+}
+
+} // namespace
+
+GameSession::GameSession(const TextureAtlas& atlas)
+    : atlas(atlas),
+      view(sf::FloatRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT)),
+      player(std::make_unique<Player>(0, 950)),
+      enemy(std::make_unique<Enemy>(1600, -500)),
+      levelStreamer(atlas),
+      sentinelInteraction(view, player, enemy) {
+    font = ResourceCache::get().getFont("assets/fonts/Merriweather-Regular.ttf");
+    text.setFont(*font);
+    text.setCharacterSize(24);
+    text.setFillColor(sf::Color::White);
+
+    buildLevel(LEVEL_PATHS[0], atlas, level);
+    levelStreamer.preload(LEVEL_PATHS[1]);
+    sentinelInteraction.setCurrentSolidity(level.solidity);
+
+    player->setSentinelInteraction(&sentinelInteraction);
+    player->setSpawnPoint(sf::Vector2f(0, 850));
+}
+
+void GameSession::step(float stepTime) {
+    player->storePreviousState();
+    enemy->storePreviousState();
+
+    if (currentLevel == 2 && sentinelDescendLevel2) {
+        float targetYPosition = 200.0f;
+        float descentSpeed = 500.0f;
+        if (enemy->getPosition().y < targetYPosition) {
+            enemy->setPosition(100, enemy->getPosition().y + descentSpeed * stepTime);
+        } else {
+            enemy->setPosition(100, targetYPosition);
+            sentinelDescendLevel2 = false;
+            enemyTriggered = true;
+            sentinelInteraction.startLevel2Interaction();
+        }
+    }
+
+    if (currentLevel == 3) {
+        if (sentinelDescendLevel3) {
+            float targetYPosition = 200.0f;
+            float descentSpeed = 500.0f;
+            if (enemy->getPosition().y < targetYPosition) {
+                enemy->setPosition(600, enemy->getPosition().y + descentSpeed * stepTime);
+            } else {
+                enemy->setPosition(600, targetYPosition);
+                sentinelDescendLevel3 = false;
+                enemyTriggered = true;
+                sentinelInteraction.startLevel3Interaction();
+            }
+        }
+
+        if (enemyTriggered && sentinelInteraction.isInBossFight()) {
+            // Update boss fight logic
+            sentinelInteraction.updateBossFight(stepTime, enemy, player->getPosition());
+            sentinelInteraction.checkGemCollision(player->getPosition());
+
+            // Check orb collisions with player
+            if (!player->isInvulnerable() && !player->isPlayerDead()) {
+                if (sentinelInteraction.isHitByOrb(player->getGlobalBounds())) {
+                    player->takeDamage();
+                }
+            }
+        }
+    }
+
+    if (!editing) {
+        if (playerJustReset) playerJustReset = false;
+        else player->update(stepTime, level.collisionGrid, level.getWorldBounds(), *enemy);
+
+        if (!sentinelInteraction.isAscending()) {
+            if (!sentinelInteraction.isInBossFight() || currentLevel != 3) {
+                enemy->update(stepTime, level.collisionGrid, static_cast<int>(SCREEN_WIDTH), static_cast<int>(SCREEN_HEIGHT));
+            }
+        }
+    }
+}
+
+void GameSession::update(float deltaTime) {
+    sentinelActive = false;
+    if (currentLevel == 1) {
+        sentinelInteraction.triggerInteraction(text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime,
+                                               player->getPosition(), buttonInteraction, proceedToNextLevel);
+        sentinelActive = true;
+    } else if (currentLevel == 2 && enemyTriggered) {
+        sentinelInteraction.triggerInteractionLevel2(text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime,
+                                                     player->getPosition(), buttonInteraction, proceedToNextLevel);
+        sentinelActive = true;
+    } else if (currentLevel == 3 && enemyTriggered) {
+        sentinelInteraction.triggerInteractionLevel3(text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime,
+                                                     player->getPosition(), buttonInteraction, proceedToNextLevel);
+        sentinelActive = true;
+    }
+
+    if (!editing) {
+        if (currentLevel == 1) {
+            buttonInteraction.handleInteraction(player->getPosition(), level.tileMap, enemyTriggered, enemyDescending, enemySpawned,
+                                                deltaTime);
+        } else if (currentLevel == 2) {
+            buttonInteraction.handleInteractionLevel2(player->getPosition(), level.tileMap, enemyTriggered, enemyDescending,
+                                                      sentinelDescendLevel2, deltaTime);
+        } else if (currentLevel == 3) {
+            buttonInteraction.handleInteractionLevel3(player->getPosition(), level.tileMap, enemyTriggered, enemyDescending,
+                                                      sentinelDescendLevel3, deltaTime);
+        }
+    }
+
+    sf::FloatRect worldBounds = level.getWorldBounds();
+    if (proceedToNextLevel && player->getPosition().x >= worldBounds.left + worldBounds.width - 75) {
+        advanceLevel();
+    }
+}
+
+void GameSession::draw(sf::RenderWindow& window, float interpolation) {
+    window.setView(view);
+    level.tileLayer.draw(window);
+
+    if (sentinelActive) {
+        sentinelInteraction.drawDialogue(window);
+        window.draw(text);
+    }
+
+    if (!editing) {
+        player->draw(window, interpolation);
+        enemy->draw(window, interpolation);
+
+        // Boss fight UI goes on top of the characters
+        if (currentLevel == 3 && sentinelInteraction.isInBossFight()) {
+            sentinelInteraction.drawBossFightElements(window);
+        }
+        buttonInteraction.draw(window);
+    }
+}
+
+std::uint64_t GameSession::getChecksum(std::uint64_t seed) const {
+    std::uint64_t hash = seed;
+    hashValue(hash, currentLevel);
+    hashValue(hash, enemyTriggered);
+    hashValue(hash, enemySpawned);
+    hashValue(hash, proceedToNextLevel);
+
+    hashValue(hash, player->getPosition().x);
+    hashValue(hash, player->getPosition().y);
+    hashValue(hash, player->getHealth());
+    hashValue(hash, player->isPlayerDead());
+    hashValue(hash, enemy->getPosition().x);
+    hashValue(hash, enemy->getPosition().y);
+
+    hashValue(hash, sentinelInteraction.isInBossFight());
+    hashValue(hash, sentinelInteraction.getBossHealth());
+    const OrbPool& orbs = sentinelInteraction.getOrbs();
+    hashValue(hash, orbs.size());
+    for (std::size_t i = 0; i < orbs.size(); ++i) {
+        hashValue(hash, orbs.posX[i]);
+        hashValue(hash, orbs.posY[i]);
+    }
+    return hash;
+}
+
+void GameSession::moveCamera(float focusX) {
+    sf::FloatRect worldBounds = level.getWorldBounds();
+    float halfWidth = view.getSize().x / 2;
+    float minX = worldBounds.left + halfWidth;
+    float maxX = worldBounds.left + worldBounds.width - halfWidth;
+    if (editing) maxX += view.getSize().x;
+    view.setCenter(std::clamp(focusX, minX, std::max(minX, maxX)), worldBounds.top + view.getSize().y / 2);
+}
+
+float GameSession::getPlayerFocusX(float interpolation) const {
+    return player->getInterpolatedPosition(interpolation).x + player->getGlobalBounds().width / 2;
+}
+
+void GameSession::resetCamera() {
+    view.setViewport(sf::FloatRect(0.0f, 0.0f, 1.0f, 1.0f));
+    view.setSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+    view.setCenter(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+}
+
+void GameSession::restart() {
+    currentLevel = 1;
+    proceedToNextLevel = false;
+    enemyTriggered = false;
+    enemySpawned = false;
+    sentinelInteraction.resetState();
+
+    resetPlayer();
+    teleportEnemy(1600, -500);
+
+    levelStreamer.take(LEVEL_PATHS[0], level);
+    levelStreamer.preload(LEVEL_PATHS[1]);
+
+    resetCamera();
+    text.setString("");
+    buttonInteraction.resetPrompt();
+}
+
+void GameSession::startBossFight() {
+    while (currentLevel < LEVEL_COUNT) {
+        advanceLevel();
+    }
+
+    // What pressing the button and answering T would have led to
+    teleportEnemy(600, 200);
+    enemyTriggered = true;
+    sentinelInteraction.startLevel3Interaction();
+    sentinelInteraction.startBossFight(enemy);
+}
+
+void GameSession::advanceLevel() {
+    proceedToNextLevel = false;
+    if (currentLevel == 1) {
+        currentLevel = 2;
+        levelStreamer.take(LEVEL_PATHS[1], level);
+        levelStreamer.preload(LEVEL_PATHS[2]);
+
+        teleportEnemy(100, -500);
+        enemy->flipSprite();
+        sentinelDescendLevel2 = false;
+    } else if (currentLevel == 2) {
+        currentLevel = 3;
+        levelStreamer.take(LEVEL_PATHS[2], level);
+        sentinelInteraction.setCurrentSolidity(level.solidity);
+
+        teleportEnemy(960, -500);
+        enemy->flipSprite();
+        sentinelDescendLevel3 = false;
+    } else {
+        return;
+    }
+
+    resetPlayer();
+    resetCamera();
+    enemyTriggered = false;
+    enemySpawned = false;
+    sentinelInteraction.resetState();
+    text.setString("");
+    buttonInteraction.resetPrompt();
+    playerJustReset = true;
+}
+
+void GameSession::teleportEnemy(float x, float y) {
+    // Also the previous step's position, so the draw doesn't interpolate from the old spot
+    enemy->setPosition(x, y);
+    enemy->storePreviousState();
+}
+
+void GameSession::resetPlayer() {
+    player->setPosition(0, 850);
+    player->setSpawnPoint(sf::Vector2f(0, 850));
+    player->resetState();
+    player->resetHealth();
+}
@@ -0,0 +1,41 @@
+#include "../include/Input.hpp"
+
+namespace {
+
+bool keyboardEnabled = true;
+InputFrame currentFrame = 0;
+
+int getInputBit(sf::Keyboard::Key key) {
+    for (int bit = 0; bit < INPUT_KEY_COUNT; ++bit) {
+        if (INPUT_KEYS[bit] == key) return bit;
+    }
+    return -1;
+}
+
+} // namespace
+
+void setKeyboardEnabled(bool enabled) {
+    keyboardEnabled = enabled;
+}
+
+void pollInput() {
+    currentFrame = 0;
+    if (!keyboardEnabled) return;
+
+    for (int bit = 0; bit < INPUT_KEY_COUNT; ++bit) {
+        if (sf::Keyboard::isKeyPressed(INPUT_KEYS[bit])) currentFrame |= InputFrame(1) << bit;
+    }
+}
+
+void setInputFrame(InputFrame frame) {
+    currentFrame = frame;
+}
+
+InputFrame getInputFrame() {
+    return currentFrame;
+}
+
+bool isKeyPressed(sf::Keyboard::Key key) {
+    int bit = getInputBit(key);
+    return bit >= 0 && (currentFrame >> bit) & 1u;
+}
@@ -0,0 +1,121 @@
+#include "../include/InputRecording.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+const char INPUT_RECORDING_MAGIC[4] = {'V', 'E', 'X', 'R'};
+const std::uint32_t FLAG_BOSS_FIGHT = 1;
+
+struct InputFileHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t flags;
+    std::uint32_t frameCount;
+    std::uint32_t runCount;
+    std::uint32_t reserved;
+    std::uint64_t checksum;
+    std::uint64_t seed;
+};
+
+struct InputFileRun {
+    std::uint32_t keys;
+    std::uint32_t length;
+};
+
+static_assert(sizeof(InputFileHeader) == 40, "input header must match the on-disk layout");
+static_assert(sizeof(InputFileRun) == 8, "input run must match the on-disk layout");
+
+} // namespace
+
+void InputRecording::clear() {
+    frames.clear();
+    bossFight = false;
+    checksum = 0;
+    seed = 0;
+}
+
+bool InputRecording::saveToFile(const std::string& filepath) const {
+    std::ofstream outFile(filepath, std::ios::binary);
+    if (!outFile) {
+        std::cerr << "Error saving input recording: " << filepath << std::endl;
+        return false;
+    }
+
+    std::vector<InputFileRun> runs;
+    for (InputFrame frame : frames) {
+        if (!runs.empty() && runs.back().keys == frame) {
+            ++runs.back().length;
+        } else {
+            runs.push_back({frame, 1});
+        }
+    }
+
+    InputFileHeader header;
+    std::memcpy(header.magic, INPUT_RECORDING_MAGIC, sizeof(INPUT_RECORDING_MAGIC));
+    header.version = INPUT_RECORDING_VERSION;
+    header.flags = bossFight ? FLAG_BOSS_FIGHT : 0;
+    header.frameCount = static_cast<std::uint32_t>(frames.size());
+    header.runCount = static_cast<std::uint32_t>(runs.size());
+    header.reserved = 0;
+    header.checksum = checksum;
+    header.seed = seed;
+
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outFile.write(reinterpret_cast<const char*>(runs.data()), runs.size() * sizeof(InputFileRun));
+    return static_cast<bool>(outFile);
+}
+
+bool InputRecording::loadFromFile(const std::string& filepath) {
+    clear();
+
+    std::ifstream inFile(filepath, std::ios::binary);
+    if (!inFile) {
+        std::cerr << "Error loading input recording: " << filepath << std::endl;
+        return false;
+    }
+
+    InputFileHeader header;
+    if (!inFile.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, INPUT_RECORDING_MAGIC, sizeof(INPUT_RECORDING_MAGIC)) != 0 ||
+        header.version != INPUT_RECORDING_VERSION) {
+        std::cerr << "Not a version " << INPUT_RECORDING_VERSION << " input recording: " << filepath << std::endl;
+        return false;
+    }
+
+    // Check both counts before allocating for them: the runs must fit in the
+    // rest of the file, and their lengths must add up to frameCount
+    inFile.seekg(0, std::ios::end);
+    std::uint64_t runBytes = static_cast<std::uint64_t>(inFile.tellg()) - sizeof(header);
+    if (header.runCount > runBytes / sizeof(InputFileRun)) {
+        std::cerr << "Truncated input recording: " << filepath << std::endl;
+        return false;
+    }
+    inFile.seekg(sizeof(header));
+
+    std::vector<InputFileRun> runs(header.runCount);
+    if (!inFile.read(reinterpret_cast<char*>(runs.data()), runs.size() * sizeof(InputFileRun))) {
+        std::cerr << "Truncated input recording: " << filepath << std::endl;
+        return false;
+    }
+
+    std::uint64_t runFrames = 0;
+    for (const InputFileRun& run : runs) {
+        runFrames += run.length;
+    }
+    if (runFrames != header.frameCount) {
+        std::cerr << "Corrupt input recording: " << filepath << std::endl;
+        return false;
+    }
+
+    frames.reserve(header.frameCount);
+    for (const InputFileRun& run : runs) {
+        frames.insert(frames.end(), run.length, run.keys);
+    }
+
+    bossFight = (header.flags & FLAG_BOSS_FIGHT) != 0;
+    checksum = header.checksum;
+    seed = header.seed;
+    return true;
+}
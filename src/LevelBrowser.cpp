@@ -0,0 +1,177 @@
+#include "../include/LevelBrowser.hpp"
+#include "../include/ResourceCache.hpp"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+LevelBrowser::LevelBrowser(const std::string& directory)
+    : directory(directory), font(ResourceCache::get().getFont("assets/fonts/Merriweather-Regular.ttf")) {}
+
+void LevelBrowser::openSave(const std::string& currentPath) {
+    mode = Mode::Save;
+    refreshFiles();
+    fileName = currentPath.empty() ? "" : fs::path(currentPath).replace_extension(".txt").filename().string();
+    auto current = std::find(files.begin(), files.end(), fileName);
+    select(current == files.end() ? -1 : static_cast<int>(current - files.begin()));
+}
+
+void LevelBrowser::openLoad() {
+    mode = Mode::Load;
+    refreshFiles();
+    fileName.clear();
+    select(files.empty() ? -1 : 0);
+}
+
+void LevelBrowser::close() {
+    mode = Mode::Closed;
+}
+
+void LevelBrowser::refreshFiles() {
+    files.clear();
+    std::error_code error;
+    for (const auto& entry : fs::directory_iterator(directory, error)) {
+        std::string extension = entry.path().extension().string();
+        if (entry.is_regular_file(error) && (extension == ".txt" || (mode == Mode::Load && extension == ".vexl"))) {
+            files.push_back(entry.path().filename().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    firstVisibleRow = 0;
+}
+
+void LevelBrowser::select(int index) {
+    if (files.empty()) {
+        selection = -1;
+        return;
+    }
+    selection = std::clamp(index, -1, static_cast<int>(files.size()) - 1);
+    if (selection < 0) return;
+
+    if (mode == Mode::Save) fileName = files[selection];
+    if (selection < firstVisibleRow) firstVisibleRow = selection;
+    if (selection >= firstVisibleRow + VISIBLE_ROWS) firstVisibleRow = selection - VISIBLE_ROWS + 1;
+}
+
+bool LevelBrowser::confirm() {
+    if (mode == Mode::Load) {
+        if (selection < 0) return false;
+        selectedPath = (fs::path(directory) / files[selection]).string();
+    } else {
+        if (fileName.empty()) return false;
+        // The editor always writes text levels
+        selectedPath = (fs::path(directory) / fs::path(fileName).replace_extension(".txt")).string();
+    }
+    close();
+    return true;
+}
+
+bool LevelBrowser::handleEvent(const sf::Event& event, const sf::RenderWindow& window) {
+    if (!isOpen()) return false;
+
+    if (event.type == sf::Event::KeyPressed) {
+        switch (event.key.code) {
+            case sf::Keyboard::Escape: close(); return false;
+            case sf::Keyboard::Enter:  return confirm();
+            case sf::Keyboard::Up:     select(std::max(selection - 1, 0)); return false;
+            case sf::Keyboard::Down:   select(selection + 1); return false;
+            default: return false;
+        }
+    }
+
+    if (event.type == sf::Event::TextEntered && mode == Mode::Save) {
+        sf::Uint32 character = event.text.unicode;
+        if (character == '\b') {
+            if (!fileName.empty()) fileName.pop_back();
+        } else if (character < 128 && (std::isalnum(static_cast<int>(character)) || character == '_' || character == '-' || character == '.')) {
+            fileName += static_cast<char>(character);
+        }
+        selection = -1;
+        return false;
+    }
+
+    if (event.type == sf::Event::MouseWheelScrolled) {
+        int maxFirstRow = std::max(0, static_cast<int>(files.size()) - VISIBLE_ROWS);
+        firstVisibleRow = std::clamp(firstVisibleRow - static_cast<int>(event.mouseWheelScroll.delta), 0, maxFirstRow);
+        return false;
+    }
+
+    if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+        sf::Vector2f point = window.mapPixelToCoords(sf::Vector2i(event.mouseButton.x, event.mouseButton.y), window.getDefaultView());
+        sf::FloatRect panel = getPanelBounds(window.getDefaultView().getSize());
+        float listTop = panel.top + ROW_HEIGHT * 2;
+        if (point.x < panel.left || point.x > panel.left + panel.width || point.y < listTop) return false;
+
+        int row = firstVisibleRow + static_cast<int>((point.y - listTop) / ROW_HEIGHT);
+        if (row >= static_cast<int>(files.size()) || row >= firstVisibleRow + VISIBLE_ROWS) return false;
+        // Clicking the selected file again confirms it
+        if (row == selection) return confirm();
+        select(row);
+    }
+    return false;
+}
+
+sf::FloatRect LevelBrowser::getPanelBounds(const sf::Vector2f& screenSize) const {
+    float height = ROW_HEIGHT * (VISIBLE_ROWS + 4);
+    return sf::FloatRect((screenSize.x - PANEL_WIDTH) / 2, (screenSize.y - height) / 2, PANEL_WIDTH, height);
+}
+
+void LevelBrowser::draw(sf::RenderWindow& window) const {
+    if (!isOpen()) return;
+
+    sf::View previousView = window.getView();
+    window.setView(window.getDefaultView());
+
+    sf::FloatRect panelBounds = getPanelBounds(window.getDefaultView().getSize());
+    sf::RectangleShape panel(sf::Vector2f(panelBounds.width, panelBounds.height));
+    panel.setPosition(panelBounds.left, panelBounds.top);
+    panel.setFillColor(sf::Color(20, 20, 30, 230));
+    panel.setOutlineColor(sf::Color(255, 255, 255, 120));
+    panel.setOutlineThickness(2.0f);
+    window.draw(panel);
+
+    sf::Text line;
+    line.setFont(*font);
+    line.setCharacterSize(20);
+    line.setFillColor(sf::Color::White);
+
+    float x = panelBounds.left + 16.0f;
+    float y = panelBounds.top + 8.0f;
+    if (mode == Mode::Save) {
+        line.setString("Save level as: " + fileName + "_");
+    } else {
+        line.setString("Load level from " + directory + "/");
+    }
+    line.setPosition(x, y);
+    window.draw(line);
+
+    sf::RectangleShape highlight(sf::Vector2f(panelBounds.width - 16.0f, ROW_HEIGHT));
+    highlight.setFillColor(sf::Color(255, 255, 255, 50));
+
+    float listTop = panelBounds.top + ROW_HEIGHT * 2;
+    int lastRow = std::min(static_cast<int>(files.size()), firstVisibleRow + VISIBLE_ROWS);
+    for (int row = firstVisibleRow; row < lastRow; ++row) {
+        float rowY = listTop + (row - firstVisibleRow) * ROW_HEIGHT;
+        if (row == selection) {
+            highlight.setPosition(panelBounds.left + 8.0f, rowY);
+            window.draw(highlight);
+        }
+        line.setString(files[row]);
+        line.setPosition(x, rowY + 2.0f);
+        window.draw(line);
+    }
+    if (files.empty()) {
+        line.setString("(no levels)");
+        line.setPosition(x, listTop + 2.0f);
+        window.draw(line);
+    }
+
+    line.setCharacterSize(16);
+    line.setFillColor(sf::Color(200, 200, 200));
+    line.setString("Enter: confirm    Esc: cancel    Up/Down or click: choose");
+    line.setPosition(x, panelBounds.top + panelBounds.height - ROW_HEIGHT);
+    window.draw(line);
+
+    window.setView(previousView);
+}
@@ -0,0 +1,286 @@
+#include "../include/LevelEditor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+LevelEditor::LevelEditor(const TextureAtlas& atlas, float gridSize) : atlas(atlas), gridSize(gridSize) {}
+
+void LevelEditor::attach(LoadedLevel& level) {
+    this->level = &level;
+    draggingRectangle = false;
+}
+
+void LevelEditor::handleEvent(const sf::Event& event, const sf::RenderWindow& window, AssetType currentAsset) {
+    if (event.type == sf::Event::KeyPressed) {
+        switch (event.key.code) {
+            case sf::Keyboard::B:        tool = Tool::Brush; break;
+            case sf::Keyboard::R:        tool = Tool::Rectangle; break;
+            case sf::Keyboard::F:        tool = Tool::FloodFill; break;
+            case sf::Keyboard::LBracket: brushSize = std::max(brushSize - 1, 1); break;
+            case sf::Keyboard::RBracket: brushSize = std::min(brushSize + 1, MAX_BRUSH_SIZE); break;
+            default: break;
+        }
+        if (tool != Tool::Rectangle) draggingRectangle = false;
+        return;
+    }
+
+    if (event.type == sf::Event::MouseButtonPressed &&
+        (event.mouseButton.button == sf::Mouse::Left || event.mouseButton.button == sf::Mouse::Right)) {
+        sf::Vector2f worldPos = window.mapPixelToCoords(sf::Vector2i(event.mouseButton.x, event.mouseButton.y));
+        if (tool == Tool::Rectangle) {
+            draggingRectangle = true;
+            dragButton = event.mouseButton.button;
+            dragStart = worldPos;
+        } else if (tool == Tool::FloodFill) {
+            if (event.mouseButton.button == sf::Mouse::Left) floodFill(worldPos, currentAsset);
+            else floodErase(worldPos);
+        }
+    }
+
+    if (event.type == sf::Event::MouseButtonReleased && draggingRectangle && event.mouseButton.button == dragButton) {
+        sf::Vector2f worldPos = window.mapPixelToCoords(sf::Vector2i(event.mouseButton.x, event.mouseButton.y));
+        if (dragButton == sf::Mouse::Left) fillRectangle(dragStart, worldPos, currentAsset);
+        else eraseRectangle(dragStart, worldPos);
+        draggingRectangle = false;
+    }
+}
+
+void LevelEditor::update(const sf::RenderWindow& window, AssetType currentAsset) {
+    if (tool != Tool::Brush) return;
+
+    sf::Vector2f worldPos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+    if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
+        paint(worldPos, currentAsset);
+    } else if (sf::Mouse::isButtonPressed(sf::Mouse::Right)) {
+        erase(worldPos);
+    }
+}
+
+void LevelEditor::drawCursor(sf::RenderWindow& window) const {
+    sf::Vector2f worldPos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+
+    sf::IntRect area;
+    if (tool == Tool::Brush) {
+        sf::Vector2i first = toCell(worldPos) - sf::Vector2i((brushSize - 1) / 2, (brushSize - 1) / 2);
+        area = sf::IntRect(first, sf::Vector2i(brushSize, brushSize));
+    } else if (tool == Tool::Rectangle && draggingRectangle) {
+        area = cellRect(dragStart, worldPos);
+    } else {
+        area = sf::IntRect(toCell(worldPos), sf::Vector2i(1, 1));
+    }
+
+    sf::RectangleShape outline(sf::Vector2f(area.width * gridSize, area.height * gridSize));
+    outline.setPosition(area.left * gridSize, area.top * gridSize);
+    outline.setFillColor(sf::Color(255, 255, 255, 30));
+    outline.setOutlineColor(sf::Color(255, 255, 255, 180));
+    outline.setOutlineThickness(-2.0f);
+    window.draw(outline);
+}
+
+bool LevelEditor::hasTile(const sf::Vector2f& worldPos) const {
+    sf::Vector2i cell = toCell(worldPos);
+    return level && level->tileMap.get(cell.x, cell.y) != TileMap::EMPTY;
+}
+
+std::size_t LevelEditor::paint(const sf::Vector2f& worldPos, AssetType type) {
+    return placeCells(brushCells(worldPos), type);
+}
+
+std::size_t LevelEditor::erase(const sf::Vector2f& worldPos) {
+    return eraseCells(brushCells(worldPos));
+}
+
+std::size_t LevelEditor::fillRectangle(const sf::Vector2f& from, const sf::Vector2f& to, AssetType type) {
+    return placeCells(rectangleCells(from, to), type);
+}
+
+std::size_t LevelEditor::eraseRectangle(const sf::Vector2f& from, const sf::Vector2f& to) {
+    return eraseCells(rectangleCells(from, to));
+}
+
+std::size_t LevelEditor::floodFill(const sf::Vector2f& worldPos, AssetType type) {
+    if (!level || hasTile(worldPos)) return 0;
+
+    // Empty space is unbounded, so the fill stops at the edges of the level
+    sf::FloatRect world = level->getWorldBounds();
+    sf::IntRect limits = cellRect(sf::Vector2f(world.left, world.top),
+                                  sf::Vector2f(world.left + world.width - 1, world.top + world.height - 1));
+    sf::Vector2i start = toCell(worldPos);
+    if (!limits.contains(start)) return 0;
+
+    std::vector<sf::Vector2i> filled;
+    std::vector<sf::Vector2i> frontier{start};
+    std::unordered_set<GridKey> visited{cellKey(start)};
+    const sf::Vector2i neighbours[] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    while (!frontier.empty()) {
+        sf::Vector2i cell = frontier.back();
+        frontier.pop_back();
+        filled.push_back(cell);
+
+        for (const auto& offset : neighbours) {
+            sf::Vector2i next = cell + offset;
+            if (!limits.contains(next) || level->tileMap.get(next.x, next.y) != TileMap::EMPTY) continue;
+            if (!visited.insert(cellKey(next)).second) continue;
+            frontier.push_back(next);
+        }
+    }
+    return placeCells(filled, type);
+}
+
+std::size_t LevelEditor::floodErase(const sf::Vector2f& worldPos) {
+    if (!level) return 0;
+
+    sf::Vector2i start = toCell(worldPos);
+    TileMap::TileId id = level->tileMap.get(start.x, start.y);
+    if (id == TileMap::EMPTY) return 0;
+
+    std::vector<sf::Vector2i> matched;
+    std::vector<sf::Vector2i> frontier{start};
+    std::unordered_set<GridKey> visited{cellKey(start)};
+    const sf::Vector2i neighbours[] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    while (!frontier.empty()) {
+        sf::Vector2i cell = frontier.back();
+        frontier.pop_back();
+        matched.push_back(cell);
+
+        for (const auto& offset : neighbours) {
+            sf::Vector2i next = cell + offset;
+            if (level->tileMap.get(next.x, next.y) != id) continue;
+            if (visited.insert(cellKey(next)).second) frontier.push_back(next);
+        }
+    }
+    return eraseCells(matched);
+}
+
+std::size_t LevelEditor::placeCells(const std::vector<sf::Vector2i>& targets, AssetType type) {
+    if (!level || !atlas.contains(type)) return 0;
+
+    bool solid = isSolidAssetType(type);
+    std::size_t placed = 0;
+    std::vector<sf::FloatRect> addedBoxes;
+
+    for (const auto& cell : targets) {
+        if (level->tileMap.get(cell.x, cell.y) != TileMap::EMPTY) continue;
+
+        level->tileMap.set(cell.x, cell.y, type);
+        level->tileLayer.invalidateCell(cell.x, cell.y);
+        if (solid) addedBoxes.push_back(collisionBox(sf::Vector2f(cell.x * gridSize, cell.y * gridSize), type));
+        ++placed;
+    }
+
+    addCollision(addedBoxes);
+    return placed;
+}
+
+std::size_t LevelEditor::eraseCells(const std::vector<sf::Vector2i>& targets) {
+    if (!level) return 0;
+
+    std::size_t erased = 0;
+    std::vector<sf::FloatRect> removedBoxes;
+
+    for (const auto& cell : targets) {
+        TileMap::TileId id = level->tileMap.get(cell.x, cell.y);
+        if (id == TileMap::EMPTY) continue;
+
+        AssetType type = static_cast<AssetType>(id);
+        level->tileMap.erase(cell.x, cell.y);
+        level->tileLayer.invalidateCell(cell.x, cell.y);
+        if (isSolidAssetType(type) && atlas.contains(type)) {
+            removedBoxes.push_back(collisionBox(sf::Vector2f(cell.x * gridSize, cell.y * gridSize), type));
+        }
+        ++erased;
+    }
+
+    removeCollision(removedBoxes);
+    return erased;
+}
+
+std::vector<sf::Vector2i> LevelEditor::brushCells(const sf::Vector2f& worldPos) const {
+    sf::Vector2i first = toCell(worldPos) - sf::Vector2i((brushSize - 1) / 2, (brushSize - 1) / 2);
+    std::vector<sf::Vector2i> brush;
+    brush.reserve(brushSize * brushSize);
+    for (int y = 0; y < brushSize; ++y) {
+        for (int x = 0; x < brushSize; ++x) {
+            brush.emplace_back(first.x + x, first.y + y);
+        }
+    }
+    return brush;
+}
+
+std::vector<sf::Vector2i> LevelEditor::rectangleCells(const sf::Vector2f& from, const sf::Vector2f& to) const {
+    sf::IntRect area = cellRect(from, to);
+    std::vector<sf::Vector2i> rectangle;
+    rectangle.reserve(static_cast<std::size_t>(area.width) * area.height);
+    for (int y = area.top; y < area.top + area.height; ++y) {
+        for (int x = area.left; x < area.left + area.width; ++x) {
+            rectangle.emplace_back(x, y);
+        }
+    }
+    return rectangle;
+}
+
+sf::IntRect LevelEditor::cellRect(const sf::Vector2f& from, const sf::Vector2f& to) const {
+    sf::Vector2i a = toCell(from);
+    sf::Vector2i b = toCell(to);
+    sf::Vector2i first(std::min(a.x, b.x), std::min(a.y, b.y));
+    sf::Vector2i last(std::max(a.x, b.x), std::max(a.y, b.y));
+    return sf::IntRect(first, last - first + sf::Vector2i(1, 1));
+}
+
+sf::Vector2i LevelEditor::toCell(const sf::Vector2f& worldPos) const {
+    return sf::Vector2i(static_cast<int>(std::floor(worldPos.x / gridSize)), static_cast<int>(std::floor(worldPos.y / gridSize)));
+}
+
+sf::FloatRect LevelEditor::collisionBox(const sf::Vector2f& position, AssetType type) const {
+    sf::Vector2f size = atlas.getSize(type);
+    float topOffset = getAssetInfo(type).collisionTopOffset;
+    return sf::FloatRect(position.x, position.y + topOffset, size.x, size.y - topOffset);
+}
+
+void LevelEditor::addCollision(const std::vector<sf::FloatRect>& added) {
+    if (added.empty()) return;
+
+    // Pull out the boxes touching the new ones and merge them back together in
+    // one go, so painting leaves no seams for the player to catch on.
+    const float margin = 0.5f;
+    float left = added.front().left, top = added.front().top;
+    float right = left + added.front().width, bottom = top + added.front().height;
+    for (const auto& box : added) {
+        left = std::min(left, box.left);
+        top = std::min(top, box.top);
+        right = std::max(right, box.left + box.width);
+        bottom = std::max(bottom, box.top + box.height);
+    }
+
+    std::vector<sf::FloatRect> pieces = level->collisionGrid.extract(
+        sf::FloatRect(left - margin, top - margin, right - left + margin * 2, bottom - top + margin * 2));
+    pieces.insert(pieces.end(), added.begin(), added.end());
+    for (const auto& merged : CollisionGrid::mergeBoxes(std::move(pieces))) {
+        level->collisionGrid.insert(merged);
+    }
+}
+
+void LevelEditor::removeCollision(const std::vector<sf::FloatRect>& removed) {
+    if (removed.empty()) return;
+
+    // Removed tiles may be part of merged boxes; rebuild just those boxes from
+    // the solid tiles still under them.
+    std::vector<sf::FloatRect> extracted;
+    for (const auto& box : removed) {
+        std::vector<sf::FloatRect> hits = level->collisionGrid.extract(box);
+        extracted.insert(extracted.end(), hits.begin(), hits.end());
+    }
+
+    std::vector<sf::FloatRect> pieces;
+    for (const auto& box : extracted) {
+        sf::IntRect area = cellRect(sf::Vector2f(box.left, box.top), sf::Vector2f(box.left + box.width, box.top + box.height));
+        level->tileMap.forEachTileIn(area, [&](const sf::Vector2f& position, AssetType type) {
+            if (!isSolidAssetType(type) || !atlas.contains(type)) return;
+            sf::FloatRect remaining = collisionBox(position, type);
+            if (remaining.intersects(box)) pieces.push_back(remaining);
+        });
+    }
+    for (const auto& merged : CollisionGrid::mergeBoxes(std::move(pieces))) {
+        level->collisionGrid.insert(merged);
+    }
+}
@@ -0,0 +1,220 @@
+#include "../include/LevelIO.hpp"
+#include "../include/CollisionGrid.hpp"
+#include "../include/TraceRecorder.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char LEVEL_FILE_MAGIC[4] = {'V', 'E', 'X', 'L'};
+
+struct LevelFileHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t tileCount;
+    std::uint32_t collisionBoxCount;
+    std::uint32_t tileOffset;
+    std::uint32_t collisionBoxOffset;
+};
+
+struct LevelFileTile {
+    float x;
+    float y;
+    std::uint32_t type;
+};
+
+struct LevelFileBox {
+    float left;
+    float top;
+    float width;
+    float height;
+};
+
+static_assert(sizeof(LevelFileHeader) == 24, "level header must match the on-disk layout");
+static_assert(sizeof(LevelFileTile) == 12, "level tile must match the on-disk layout");
+static_assert(sizeof(LevelFileBox) == 16, "level box must match the on-disk layout");
+
+// Read-only mapping of a whole file, unmapped when it goes out of scope.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& filepath) {
+        int fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                data = static_cast<const unsigned char*>(mapped);
+                size = static_cast<std::size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (data) ::munmap(const_cast<unsigned char*>(data), size);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* data{nullptr};
+    std::size_t size{0};
+};
+
+bool sectionFits(std::size_t fileSize, std::uint32_t offset, std::uint32_t count, std::size_t elementSize) {
+    if (offset % 4 != 0 || offset > fileSize) return false;
+    return count <= (fileSize - offset) / elementSize;
+}
+
+} // namespace
+
+std::vector<sf::FloatRect> buildCollisionBoxes(const std::vector<std::pair<sf::Vector2f, AssetType>>& tiles,
+                                               const std::vector<sf::Vector2f>& assetSizes) {
+    std::vector<sf::FloatRect> solidBoxes;
+    solidBoxes.reserve(tiles.size());
+    for (const auto& tile : tiles) {
+        std::size_t index = static_cast<std::size_t>(tile.second);
+        if (!isSolidAssetType(tile.second) || index >= assetSizes.size()) continue;
+
+        sf::Vector2f size = assetSizes[index];
+        if (size.x <= 0 || size.y <= 0) continue;
+
+        float topOffset = getAssetInfo(tile.second).collisionTopOffset;
+        solidBoxes.emplace_back(tile.first.x, tile.first.y + topOffset, size.x, size.y - topOffset);
+    }
+    return CollisionGrid::mergeBoxes(std::move(solidBoxes));
+}
+
+bool loadLevelText(const std::string& filepath, std::vector<std::pair<sf::Vector2f, AssetType>>& tiles) {
+    std::ifstream inFile(filepath);
+    if (!inFile) {
+        std::cerr << "Error loading level: " << filepath << std::endl;
+        return false;
+    }
+
+    tiles.clear();
+    float x, y;
+    int assetTypeInt;
+    while (inFile >> x >> y >> assetTypeInt) {
+        if (!isValidAssetType(assetTypeInt)) continue;
+        tiles.emplace_back(sf::Vector2f(x, y), static_cast<AssetType>(assetTypeInt));
+    }
+    return true;
+}
+
+bool saveLevelText(const std::string& filepath, const std::vector<std::pair<sf::Vector2f, AssetType>>& tiles) {
+    std::ofstream outFile(filepath);
+    if (!outFile) {
+        std::cerr << "Error saving level: " << filepath << std::endl;
+        return false;
+    }
+
+    for (const auto& tileData : tiles) {
+        outFile << tileData.first.x << " " << tileData.first.y << " " << static_cast<int>(tileData.second) << "\n";
+    }
+    return true;
+}
+
+bool loadLevelBinary(const std::string& filepath, LevelData& level) {
+    MappedFile file(filepath);
+    if (!file.data || file.size < sizeof(LevelFileHeader)) {
+        std::cerr << "Error loading level: " << filepath << std::endl;
+        return false;
+    }
+
+    LevelFileHeader header;
+    std::memcpy(&header, file.data, sizeof(header));
+    if (std::memcmp(header.magic, LEVEL_FILE_MAGIC, sizeof(LEVEL_FILE_MAGIC)) != 0 || header.version != LEVEL_FILE_VERSION) {
+        std::cerr << "Error loading level: " << filepath << " is not a version " << LEVEL_FILE_VERSION << " level" << std::endl;
+        return false;
+    }
+    if (!sectionFits(file.size, header.tileOffset, header.tileCount, sizeof(LevelFileTile)) ||
+        !sectionFits(file.size, header.collisionBoxOffset, header.collisionBoxCount, sizeof(LevelFileBox))) {
+        std::cerr << "Error loading level: " << filepath << " is truncated" << std::endl;
+        return false;
+    }
+
+    // The sections are aligned and sized to the structs above, so both arrays are
+    // read in place from the mapping.
+    const auto* fileTiles = reinterpret_cast<const LevelFileTile*>(file.data + header.tileOffset);
+    const auto* fileBoxes = reinterpret_cast<const LevelFileBox*>(file.data + header.collisionBoxOffset);
+
+    level.tiles.clear();
+    level.tiles.reserve(header.tileCount);
+    for (std::uint32_t i = 0; i < header.tileCount; ++i) {
+        if (!isValidAssetType(static_cast<int>(fileTiles[i].type))) continue;
+        level.tiles.emplace_back(sf::Vector2f(fileTiles[i].x, fileTiles[i].y), static_cast<AssetType>(fileTiles[i].type));
+    }
+
+    level.collisionBoxes.resize(header.collisionBoxCount);
+    for (std::uint32_t i = 0; i < header.collisionBoxCount; ++i) {
+        level.collisionBoxes[i] = sf::FloatRect(fileBoxes[i].left, fileBoxes[i].top, fileBoxes[i].width, fileBoxes[i].height);
+    }
+    return true;
+}
+
+bool saveLevelBinary(const std::string& filepath, const LevelData& level) {
+    std::ofstream outFile(filepath, std::ios::binary);
+    if (!outFile) {
+        std::cerr << "Error saving level: " << filepath << std::endl;
+        return false;
+    }
+
+    LevelFileHeader header;
+    std::memcpy(header.magic, LEVEL_FILE_MAGIC, sizeof(LEVEL_FILE_MAGIC));
+    header.version = LEVEL_FILE_VERSION;
+    header.tileCount = static_cast<std::uint32_t>(level.tiles.size());
+    header.collisionBoxCount = static_cast<std::uint32_t>(level.collisionBoxes.size());
+    header.tileOffset = sizeof(LevelFileHeader);
+    header.collisionBoxOffset = header.tileOffset + header.tileCount * static_cast<std::uint32_t>(sizeof(LevelFileTile));
+
+    std::vector<LevelFileTile> fileTiles;
+    fileTiles.reserve(level.tiles.size());
+    for (const auto& tile : level.tiles) {
+        fileTiles.push_back({tile.first.x, tile.first.y, static_cast<std::uint32_t>(tile.second)});
+    }
+
+    std::vector<LevelFileBox> fileBoxes;
+    fileBoxes.reserve(level.collisionBoxes.size());
+    for (const auto& box : level.collisionBoxes) {
+        fileBoxes.push_back({box.left, box.top, box.width, box.height});
+    }
+
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outFile.write(reinterpret_cast<const char*>(fileTiles.data()), fileTiles.size() * sizeof(LevelFileTile));
+    outFile.write(reinterpret_cast<const char*>(fileBoxes.data()), fileBoxes.size() * sizeof(LevelFileBox));
+    return static_cast<bool>(outFile);
+}
+
+std::string getBinaryLevelPath(const std::string& filepath) {
+    return std::filesystem::path(filepath).replace_extension(".vexl").string();
+}
+
+bool loadLevelData(const std::string& filepath, LevelData& level, const std::vector<sf::Vector2f>& assetSizes) {
+    namespace fs = std::filesystem;
+    VEX_TRACE_SCOPE("loadLevelData");
+
+    std::string binaryPath = getBinaryLevelPath(filepath);
+    std::error_code error;
+    if (fs::exists(binaryPath, error)) {
+        bool isCurrent = binaryPath == filepath || !fs::exists(filepath, error) ||
+                         fs::last_write_time(binaryPath, error) >= fs::last_write_time(filepath, error);
+        if (isCurrent && loadLevelBinary(binaryPath, level)) return true;
+    }
+
+    if (!loadLevelText(filepath, level.tiles)) {
+        level.tiles.clear();
+        level.collisionBoxes.clear();
+        return false;
+    }
+    level.collisionBoxes = buildCollisionBoxes(level.tiles, assetSizes);
+    return true;
+}
@@ -0,0 +1,87 @@
+#include "../include/LevelStreamer.hpp"
+#include "../include/LevelIO.hpp"
+#include "../include/TraceRecorder.hpp"
+#include <algorithm>
+#include <chrono>
+
+bool buildLevel(const std::string& path, const TextureAtlas& atlas, LoadedLevel& level) {
+    VEX_TRACE_SCOPE("buildLevel");
+
+    std::vector<sf::Vector2f> assetSizes(ASSET_TYPE_COUNT + 1);
+    for (const AssetInfo& info : ASSET_INFO) {
+        if (atlas.contains(info.type)) assetSizes[static_cast<std::size_t>(info.type)] = atlas.getSize(info.type);
+    }
+
+    LevelData data;
+    bool loaded = loadLevelData(path, data, assetSizes);
+
+    std::vector<sf::FloatRect> solidTiles;
+    for (const auto& tile : data.tiles) {
+        if (atlas.contains(tile.second) && isSolidAssetType(tile.second)) {
+            solidTiles.emplace_back(tile.first, atlas.getSize(tile.second));
+        }
+    }
+
+    level.path = path;
+    level.tileMap.build(data.tiles);
+    level.collisionGrid.build(data.collisionBoxes);
+    level.solidity.build(solidTiles);
+    level.tileLayer.reset(atlas);
+    return loaded;
+}
+
+sf::FloatRect LoadedLevel::getWorldBounds() const {
+    const sf::FloatRect screen(0.0f, 0.0f, 1920.0f, 1080.0f);
+    const sf::FloatRect& cells = tileMap.getCellBounds();
+    if (cells.width <= 0) return screen;
+
+    float left = std::min(screen.left, cells.left);
+    float right = std::max(screen.left + screen.width, cells.left + cells.width);
+    return sf::FloatRect(left, screen.top, right - left, screen.height);
+}
+
+LevelStreamer::LevelStreamer(const TextureAtlas& atlas) : atlas(atlas) {}
+
+LevelStreamer::~LevelStreamer() {
+    discardPending();
+}
+
+void LevelStreamer::preload(const std::string& path) {
+    if (pending.valid() && pendingPath == path) return;
+    discardPending();
+
+    pendingPath = path;
+    pending = std::async(std::launch::async, [this, path]() {
+        auto level = std::make_unique<LoadedLevel>();
+        buildLevel(path, atlas, *level);
+        return level;
+    });
+}
+
+bool LevelStreamer::isReady(const std::string& path) const {
+    return pending.valid() && pendingPath == path &&
+           pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool LevelStreamer::take(const std::string& path, LoadedLevel& level) {
+    if (pending.valid() && pendingPath == path) {
+        std::unique_ptr<LoadedLevel> preloaded = pending.get();
+        pendingPath.clear();
+        level = std::move(*preloaded);
+        return true;
+    }
+
+    discardPending();
+    return buildLevel(path, atlas, level);
+}
+
+void LevelStreamer::invalidate(const std::string& path) {
+    if (pendingPath == path) discardPending();
+}
+
+void LevelStreamer::discardPending() {
+    // The worker still holds the atlas, so let it finish before forgetting it
+    if (pending.valid()) pending.wait();
+    pending = std::future<std::unique_ptr<LoadedLevel>>();
+    pendingPath.clear();
+}
@@ -0,0 +1,87 @@
+#include "../include/OrbPool.hpp"
+#include <cmath>
+
+OrbPool::OrbPool(float radius) : radius(radius) {
+    for (int i = 0; i <= SEGMENTS; ++i) {
+        float theta = (static_cast<float>(i) / SEGMENTS) * 2.0f * 3.14159f;
+        circleOffsets[i] = sf::Vector2f(radius + radius * std::cos(theta), radius + radius * std::sin(theta));
+    }
+}
+
+void OrbPool::spawn(float x, float y, float angleDegrees, std::uint8_t patternId) {
+    float radians = angleDegrees * 3.14159f / 180.0f;
+    posX.push_back(x);
+    posY.push_back(y);
+    dirX.push_back(std::cos(radians));
+    dirY.push_back(std::sin(radians));
+    angle.push_back(angleDegrees);
+    pattern.push_back(patternId);
+}
+
+void OrbPool::remove(std::size_t index) {
+    std::size_t last = size() - 1;
+    if (index != last) {
+        posX[index] = posX[last];
+        posY[index] = posY[last];
+        dirX[index] = dirX[last];
+        dirY[index] = dirY[last];
+        angle[index] = angle[last];
+        pattern[index] = pattern[last];
+    }
+    posX.pop_back();
+    posY.pop_back();
+    dirX.pop_back();
+    dirY.pop_back();
+    angle.pop_back();
+    pattern.pop_back();
+}
+
+void OrbPool::clear() {
+    posX.clear();
+    posY.clear();
+    dirX.clear();
+    dirY.clear();
+    angle.clear();
+    pattern.clear();
+}
+
+void OrbPool::reserve(std::size_t count) {
+    posX.reserve(count);
+    posY.reserve(count);
+    dirX.reserve(count);
+    dirY.reserve(count);
+    angle.reserve(count);
+    pattern.reserve(count);
+}
+
+bool OrbPool::intersects(const sf::FloatRect& bounds) const {
+    float diameter = radius * 2.0f;
+    for (std::size_t i = 0; i < size(); ++i) {
+        if (posX[i] < bounds.left + bounds.width && posX[i] + diameter > bounds.left &&
+            posY[i] < bounds.top + bounds.height && posY[i] + diameter > bounds.top) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void OrbPool::buildVertices(sf::VertexArray& vertices, const std::vector<sf::Color>& palette) const {
+    vertices.setPrimitiveType(sf::Triangles);
+    vertices.resize(size() * SEGMENTS * 3);
+
+    std::size_t v = 0;
+    for (std::size_t i = 0; i < size(); ++i) {
+        sf::Color color = pattern[i] < palette.size() ? palette[pattern[i]] : sf::Color::White;
+        sf::Vector2f origin(posX[i], posY[i]);
+        sf::Vector2f center(origin.x + radius, origin.y + radius);
+
+        for (int s = 0; s < SEGMENTS; ++s) {
+            vertices[v].position = center;
+            vertices[v++].color = color;
+            vertices[v].position = origin + circleOffsets[s];
+            vertices[v++].color = color;
+            vertices[v].position = origin + circleOffsets[s + 1];
+            vertices[v++].color = color;
+        }
+    }
+}
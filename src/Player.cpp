@@ -1,13 +1,17 @@
 #include "../include/Player.hpp"
-#include "../include/Platform.hpp"
+#include "../include/CollisionGrid.hpp"
 #include "../include/Enemy.hpp"
 #include "../include/SentinelInteraction.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/Input.hpp"
+#include "../include/Profiler.hpp"
 #include <cmath>
 #include <iostream>
 
 Player::Player(float startX, float startY)
     : x(startX), y(startY), 
       prevX(startX), prevY(startY), 
+      previousStatePosition(startX, startY),
       yVelocity(0.0f), gravity(2000.0f), terminalVelocity(1000.0f), 
       speedX(600.0f), jumpVelocity(-1100.0f), 
       jumpCount(0), maxJumps(2), 
@@ -25,23 +29,15 @@ Player::Player(float startX, float startY)
       currentHealth(MAX_HEALTH),
       invulnerableTimer(0.0f)
 {
-    if (!walkingTexture.loadFromFile("assets/characters/player/veX_sprite_sheet.png")) {
-        std::cerr << "Error loading walking texture file" << std::endl;
-    }
+    walkingTexture = ResourceCache::get().getTexture("assets/characters/player/veX_sprite_sheet.png");
 
-    if (!idleTexture.loadFromFile("assets/characters/player/veX_breathe_sheet.png")) {
-        std::cerr << "Error loading idle texture file" << std::endl;
-    }
+    idleTexture = ResourceCache::get().getTexture("assets/characters/player/veX_breathe_sheet.png");
 
-    if (!jumpTexture.loadFromFile("assets/characters/player/veX_jump.png")) {
-        std::cerr << "Error loading jump texture file" << std::endl;
-    }
+    jumpTexture = ResourceCache::get().getTexture("assets/characters/player/veX_jump.png");
 
-    if (!deathTexture.loadFromFile("assets/characters/player/veX_death.png")) {
-        std::cerr << "Error loading death texture file" << std::endl;
-    }
-    
-    sprite.setTexture(idleTexture);
+    deathTexture = ResourceCache::get().getTexture("assets/characters/player/veX_death.png");
+
+    sprite.setTexture(*idleTexture);
     currentFrame = sf::IntRect(0, 0, frameWidth, frameHeight);
     sprite.setTextureRect(currentFrame);
     sprite.setPosition(x, y);
@@ -60,7 +56,9 @@ sf::Vector2f Player::getPosition() const {
     return sprite.getPosition();
 }
 
-void Player::update(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight, Enemy& enemy) {
+void Player::update(float deltaTime, const CollisionGrid& collisionGrid, const sf::FloatRect& worldBounds, Enemy& enemy) {
+    VEX_PROFILE_SCOPE(PlayerUpdate);
+
     if (isDead) {
         respawnTimer -= deltaTime;
         if (respawnTimer <= 0) {
@@ -80,7 +78,7 @@ void Player::update(float deltaTime, const std::vector<Platform>& platforms, int
 
     handleInput(deltaTime);
     applyGravity(deltaTime);
-    move(deltaTime, platforms, windowWidth, windowHeight, enemy);
+    move(deltaTime, collisionGrid, worldBounds, enemy);
 
     animationTimer += deltaTime;
     if (animationTimer >= frameDuration) {
@@ -93,16 +91,28 @@ void Player::update(float deltaTime, const std::vector<Platform>& platforms, int
     sprite.setPosition(x, y);
 
     // Death by falling
-    if (y > windowHeight + 100) {
+    if (y > worldBounds.top + worldBounds.height + 100) {
         takeDamage();
     }
 }
 
-void Player::draw(sf::RenderWindow& window) const {
-    window.draw(sprite);
+void Player::draw(sf::RenderWindow& window, float alpha) const {
+    sf::Vector2f current = sprite.getPosition();
+    sf::RenderStates states;
+    states.transform.translate((previousStatePosition - current) * (1.0f - alpha));
+    window.draw(sprite, states);
     drawHealthUI(window);
 }
 
+sf::Vector2f Player::getInterpolatedPosition(float alpha) const {
+    sf::Vector2f current = sprite.getPosition();
+    return previousStatePosition + (current - previousStatePosition) * alpha;
+}
+
+void Player::storePreviousState() {
+    previousStatePosition = sprite.getPosition();
+}
+
 sf::FloatRect Player::getGlobalBounds() const {
     return sprite.getGlobalBounds();
 }
@@ -125,20 +135,20 @@ void Player::handleInput(float deltaTime) {
     float velocityX = 0.0f;
     bool isMoving = false;
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) {
+    if (isKeyPressed(sf::Keyboard::Space)) {
         if (canJump && jumpCount < maxJumps) {
             yVelocity = jumpVelocity;
             jumpCount++;
             canJump = false;
             isJumping = true;
-            sprite.setTexture(jumpTexture);
+            sprite.setTexture(*jumpTexture);
             resetAnimation();
         }
     } else {
         canJump = true;
     }
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A)) {
+    if (isKeyPressed(sf::Keyboard::A)) {
         velocityX = -speedX;
         isMoving = true;
 
@@ -148,11 +158,11 @@ void Player::handleInput(float deltaTime) {
         }
 
         if (isIdle && !isJumping) {
-            sprite.setTexture(walkingTexture);
+            sprite.setTexture(*walkingTexture);
             resetAnimation();
             isIdle = false;
         }
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::D)) {
+    } else if (isKeyPressed(sf::Keyboard::D)) {
         velocityX = speedX;
         isMoving = true;
 
@@ -162,7 +172,7 @@ void Player::handleInput(float deltaTime) {
         }
 
         if (isIdle && !isJumping) {
-            sprite.setTexture(walkingTexture);
+            sprite.setTexture(*walkingTexture);
             resetAnimation();
             isIdle = false;
         }
@@ -178,7 +188,7 @@ void Player::handleInput(float deltaTime) {
 
     if (!isMoving && !isJumping) {
         if (!isIdle) {
-            sprite.setTexture(idleTexture);
+            sprite.setTexture(*idleTexture);
             totalFrames = idleTotalFrames;
             resetAnimation();
             isIdle = true;
@@ -186,15 +196,15 @@ void Player::handleInput(float deltaTime) {
     }
 
     if (!isMoving && !isJumping) {
-        sprite.setTexture(idleTexture);
+        sprite.setTexture(*idleTexture);
         isIdle = true;
     }
 
     if (isJumping) {
-        sprite.setTexture(jumpTexture);
+        sprite.setTexture(*jumpTexture);
         resetAnimation();
     } else if (isMoving) {
-        sprite.setTexture(walkingTexture);
+        sprite.setTexture(*walkingTexture);
     }
 }
 
@@ -212,23 +222,25 @@ void Player::applyGravity(float deltaTime) {
     }
 }
 
-void Player::boundDetection(int windowWidth, int windowHeight) {
+void Player::boundDetection(const sf::FloatRect& worldBounds) {
     float playerWidth = sprite.getGlobalBounds().width;
     float playerHeight = sprite.getGlobalBounds().height;
+    float worldRight = worldBounds.left + worldBounds.width;
+    float worldBottom = worldBounds.top + worldBounds.height;
 
-    if (x < 0) {
-        x = 0;
+    if (x < worldBounds.left) {
+        x = worldBounds.left;
     }
-    if (x + playerWidth > windowWidth) {
-        x = windowWidth - playerWidth;
+    if (x + playerWidth > worldRight) {
+        x = worldRight - playerWidth;
     }
 
-    if (y < 0) {
-        y = 0;
+    if (y < worldBounds.top) {
+        y = worldBounds.top;
         yVelocity = 0;
     }
-    if (y + playerHeight > windowHeight) {
-        y = windowHeight - playerHeight;
+    if (y + playerHeight > worldBottom) {
+        y = worldBottom - playerHeight;
         yVelocity = 0;
         jumpCount = 0;
     }
@@ -236,7 +248,7 @@ void Player::boundDetection(int windowWidth, int windowHeight) {
     sprite.setPosition(x, y);
 }
 
-void Player::move(float deltaTime, const std::vector<Platform>& platforms, int windowWidth, int windowHeight, Enemy& enemy) {
+void Player::move(float deltaTime, const CollisionGrid& collisionGrid, const sf::FloatRect& worldBounds, Enemy& enemy) {
     if (isDead) return;  // Don't move while dead
   
     if (sentinelInteraction && sentinelInteraction->isInBossFight() && !sentinelInteraction->canMove()) {
@@ -251,43 +263,38 @@ void Player::move(float deltaTime, const std::vector<Platform>& platforms, int w
     bool onGround = false;
     float edgeMargin = 10.0f;
 
-    for (const auto& platform : platforms) {
-        const auto& tiles = platform.getTiles();
-
-        for (const auto& tile : tiles) {
-            sf::FloatRect tileBounds = tile.getGlobalBounds();
-
-            if (playerBounds.intersects(tileBounds)) {
-                if (yVelocity > 0.0f) {
-                    if ((playerBounds.top + playerBounds.height) <= tileBounds.top + edgeMargin) {
-                        y = tileBounds.top - playerBounds.height;
-                        yVelocity = 0.0f;
-                        onGround = true;
-                    }
-                } else if (yVelocity < 0.0f) {
-                    if (playerBounds.top >= tileBounds.top + tileBounds.height - edgeMargin) {
-                        y = tileBounds.top + tileBounds.height;
-                        yVelocity = 0.0f;
-                    }
-                }
-
-                float playerRight = playerBounds.left + playerBounds.width;
-                float playerLeft = playerBounds.left;
-                float tileRight = tileBounds.left + tileBounds.width;
-                float tileLeft = tileBounds.left;
-
-                if (playerRight > tileLeft && playerLeft < tileLeft && 
-                    (playerBounds.top + playerBounds.height) > tileBounds.top + edgeMargin) {
-                    x = tileLeft - playerBounds.width;
-                }
-
-                if (playerLeft < tileRight && playerRight > tileRight &&
-                    (playerBounds.top + playerBounds.height) > tileBounds.top + edgeMargin) {
-                    x = tileRight;
-                }
+    // Only the solid boxes in the grid cells around the player are tested
+    collisionGrid.query(playerBounds, [&](const sf::FloatRect& tileBounds) {
+        if (!playerBounds.intersects(tileBounds)) return;
+
+        if (yVelocity > 0.0f) {
+            if ((playerBounds.top + playerBounds.height) <= tileBounds.top + edgeMargin) {
+                y = tileBounds.top - playerBounds.height;
+                yVelocity = 0.0f;
+                onGround = true;
+            }
+        } else if (yVelocity < 0.0f) {
+            if (playerBounds.top >= tileBounds.top + tileBounds.height - edgeMargin) {
+                y = tileBounds.top + tileBounds.height;
+                yVelocity = 0.0f;
             }
         }
-    }
+
+        float playerRight = playerBounds.left + playerBounds.width;
+        float playerLeft = playerBounds.left;
+        float tileRight = tileBounds.left + tileBounds.width;
+        float tileLeft = tileBounds.left;
+
+        if (playerRight > tileLeft && playerLeft < tileLeft && 
+            (playerBounds.top + playerBounds.height) > tileBounds.top + edgeMargin) {
+            x = tileLeft - playerBounds.width;
+        }
+
+        if (playerLeft < tileRight && playerRight > tileRight &&
+            (playerBounds.top + playerBounds.height) > tileBounds.top + edgeMargin) {
+            x = tileRight;
+        }
+    });
 
     sf::FloatRect enemyBounds = enemy.getGlobalBounds();
     if (playerBounds.intersects(enemyBounds)) {
@@ -314,7 +321,7 @@ void Player::move(float deltaTime, const std::vector<Platform>& platforms, int w
     }
 
     sprite.setPosition(x, y);
-    boundDetection(windowWidth, windowHeight);
+    boundDetection(worldBounds);
 }
 
 void Player::enemyDetection(Enemy& enemy) {
@@ -337,6 +344,7 @@ void Player::setPosition(float newX, float newY) {
     prevX = newX;
     prevY = newY;
     sprite.setPosition(x, y);
+    previousStatePosition = sprite.getPosition();
 }
 
 void Player::resetState() {
@@ -371,7 +379,7 @@ void Player::takeDamage() {
 void Player::die() {
     isDead = true;
     respawnTimer = RESPAWN_DELAY;
-    sprite.setTexture(deathTexture);
+    sprite.setTexture(*deathTexture);
     resetAnimation();
 }
 
@@ -385,13 +393,20 @@ void Player::respawn() {
     canJump = true;
     isJumping = false;
     isIdle = true;
-    sprite.setTexture(idleTexture);
+    sprite.setTexture(*idleTexture);
     resetAnimation();
     sprite.setPosition(x, y);
+    // Respawning happens mid-step, after storePreviousState(); snap the blend
+    // so the sprite and camera don't sweep across the level from the death spot
+    previousStatePosition = sprite.getPosition();
     invulnerableTimer = INVULNERABLE_DURATION;
 }
 
 void Player::drawHealthUI(sf::RenderWindow& window) const {
+    // Hearts stay pinned to the screen while the camera scrolls
+    sf::View previousView = window.getView();
+    window.setView(window.getDefaultView());
+
     for (int i = 0; i < MAX_HEALTH; i++) {
         // Draw empty heart
         sf::CircleShape emptyHeart = hearts[i];
@@ -405,6 +420,8 @@ void Player::drawHealthUI(sf::RenderWindow& window) const {
             window.draw(filledHeart);
         }
     }
+
+    window.setView(previousView);
 }
 
 void Player::setSpawnPoint(const sf::Vector2f& point) {
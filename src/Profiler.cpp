@@ -0,0 +1,117 @@
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const ZONE_NAMES[] = {
+    "Frame",
+    "Events",
+    "Player update",
+    "Enemy update",
+    "Boss fight",
+    "Orbs",
+    "Background",
+    "Tile draw",
+    "Display",
+};
+static_assert(sizeof(ZONE_NAMES) / sizeof(ZONE_NAMES[0]) == Profiler::ZONE_COUNT, "one name per profile zone");
+
+const unsigned OVERLAY_CHARACTER_SIZE = 16;
+const float OVERLAY_LINE_HEIGHT = 20.0f;
+const float OVERLAY_PADDING = 8.0f;
+const float OVERLAY_COLUMN_WIDTH = 90.0f;
+const float OVERLAY_NAME_WIDTH = 130.0f;
+
+} // namespace
+
+const char* getProfileZoneName(ProfileZone zone) {
+    return ZONE_NAMES[static_cast<int>(zone)];
+}
+
+Profiler& Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::endFrame() {
+    Clock::time_point now = Clock::now();
+    current[static_cast<int>(ProfileZone::Frame)] = std::chrono::duration<float, std::milli>(now - frameStart).count();
+    if (TraceRecorder::get().isRecording()) TraceRecorder::get().record(ZONE_NAMES[0], frameStart, now);
+    frameStart = now;
+
+    history[nextFrame] = current;
+    current.fill(0.0f);
+    nextFrame = (nextFrame + 1) % HISTORY_FRAMES;
+    recordedFrames = std::min(recordedFrames + 1, HISTORY_FRAMES);
+}
+
+Profiler::ZoneStats Profiler::getStats(ProfileZone zone) const {
+    ZoneStats stats;
+    if (recordedFrames == 0) return stats;
+
+    std::array<float, HISTORY_FRAMES> samples;
+    float total = 0.0f;
+    for (int frame = 0; frame < recordedFrames; ++frame) {
+        samples[frame] = history[frame][static_cast<int>(zone)];
+        total += samples[frame];
+    }
+
+    stats.averageMs = total / recordedFrames;
+    stats.worstMs = *std::max_element(samples.begin(), samples.begin() + recordedFrames);
+    auto p99 = samples.begin() + (recordedFrames - 1) * 99 / 100;
+    std::nth_element(samples.begin(), p99, samples.begin() + recordedFrames);
+    stats.p99Ms = *p99;
+    return stats;
+}
+
+void Profiler::drawOverlay(sf::RenderWindow& window, const sf::Font& font) const {
+    if (!overlayVisible) return;
+
+    sf::View previousView = window.getView();
+    window.setView(window.getDefaultView());
+
+    std::vector<std::string> rows[4];
+    rows[0].push_back("ms");
+    rows[1].push_back("avg");
+    rows[2].push_back("p99");
+    rows[3].push_back("worst");
+    for (int zone = 0; zone < ZONE_COUNT; ++zone) {
+        ZoneStats stats = getStats(static_cast<ProfileZone>(zone));
+        char buffer[16];
+        rows[0].push_back(ZONE_NAMES[zone]);
+        std::snprintf(buffer, sizeof(buffer), "%.2f", stats.averageMs);
+        rows[1].push_back(buffer);
+        std::snprintf(buffer, sizeof(buffer), "%.2f", stats.p99Ms);
+        rows[2].push_back(buffer);
+        std::snprintf(buffer, sizeof(buffer), "%.2f", stats.worstMs);
+        rows[3].push_back(buffer);
+    }
+#if !VEX_PROFILING
+    rows[0].push_back("(timers compiled out)");
+#endif
+
+    float width = OVERLAY_NAME_WIDTH + 3 * OVERLAY_COLUMN_WIDTH + 2 * OVERLAY_PADDING;
+    float height = rows[0].size() * OVERLAY_LINE_HEIGHT + 2 * OVERLAY_PADDING;
+    sf::RectangleShape panel(sf::Vector2f(width, height));
+    panel.setPosition(OVERLAY_PADDING, OVERLAY_PADDING);
+    panel.setFillColor(sf::Color(0, 0, 0, 180));
+    window.draw(panel);
+
+    sf::Text text;
+    text.setFont(font);
+    text.setCharacterSize(OVERLAY_CHARACTER_SIZE);
+    text.setFillColor(sf::Color::White);
+    for (int column = 0; column < 4; ++column) {
+        float x = 2 * OVERLAY_PADDING + (column == 0 ? 0.0f : OVERLAY_NAME_WIDTH + (column - 1) * OVERLAY_COLUMN_WIDTH);
+        for (std::size_t row = 0; row < rows[column].size(); ++row) {
+            text.setString(rows[column][row]);
+            text.setPosition(x, 2 * OVERLAY_PADDING + row * OVERLAY_LINE_HEIGHT);
+            window.draw(text);
+        }
+    }
+
+    window.setView(previousView);
+}
@@ -0,0 +1,35 @@
+#include "../include/RandomService.hpp"
+
+namespace {
+
+std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+} // namespace
+
+void RandomStream::reseed(std::uint64_t seed) {
+    std::uint64_t mix = seed;
+    std::uint64_t low = splitMix64(mix);
+    std::uint64_t high = splitMix64(mix);
+    state = {static_cast<std::uint32_t>(low), static_cast<std::uint32_t>(low >> 32),
+             static_cast<std::uint32_t>(high), static_cast<std::uint32_t>(high >> 32)};
+    // xoshiro's one forbidden state; splitmix64 practically never produces it
+    if ((state[0] | state[1] | state[2] | state[3]) == 0) state[0] = 1;
+}
+
+RandomService& RandomService::get() {
+    static RandomService service;
+    return service;
+}
+
+void RandomService::seed(std::uint64_t masterSeed) {
+    this->masterSeed = masterSeed;
+    std::uint64_t mix = masterSeed;
+    for (RandomStream& stream : streams) {
+        stream.reseed(splitMix64(mix));
+    }
+}
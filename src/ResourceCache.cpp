@@ -0,0 +1,103 @@
+#include "../include/ResourceCache.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+ResourceCache& ResourceCache::get() {
+    static ResourceCache cache;
+    return cache;
+}
+
+std::shared_ptr<sf::Texture> ResourceCache::getTexture(const std::string& path) {
+    if (!graphicsEnabled) return std::make_shared<sf::Texture>();
+
+    auto cached = textures.find(path);
+    if (cached != textures.end()) {
+        if (auto texture = cached->second.lock()) return texture;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromFile(path)) {
+        std::cerr << "Error loading texture from " << path << std::endl;
+        return texture;
+    }
+    textures[path] = texture;
+    return texture;
+}
+
+std::shared_ptr<sf::Texture> ResourceCache::addTexture(const std::string& path, const sf::Image& image) {
+    if (!graphicsEnabled) return std::make_shared<sf::Texture>();
+
+    auto cached = textures.find(path);
+    if (cached != textures.end()) {
+        if (auto texture = cached->second.lock()) return texture;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromImage(image)) {
+        std::cerr << "Error uploading texture " << path << std::endl;
+        return texture;
+    }
+    textures[path] = texture;
+    return texture;
+}
+
+std::shared_ptr<sf::Font> ResourceCache::getFont(const std::string& path) {
+    auto cached = fonts.find(path);
+    if (cached != fonts.end()) {
+        if (auto font = cached->second.font.lock()) return font;
+    }
+
+    auto font = std::make_shared<sf::Font>();
+    if (!font->loadFromFile(path)) {
+        std::cerr << "Error loading font from " << path << std::endl;
+        return font;
+    }
+
+    std::error_code error;
+    auto fileSize = std::filesystem::file_size(path, error);
+    fonts[path] = FontEntry{font, error ? 0 : static_cast<std::size_t>(fileSize)};
+    return font;
+}
+
+std::vector<ResourceCache::ResidentResource> ResourceCache::getResidentResources() const {
+    std::vector<ResidentResource> resident;
+    for (const auto& entry : textures) {
+        if (auto texture = entry.second.lock()) {
+            sf::Vector2u size = texture->getSize();
+            // use_count() includes the reference just taken by lock()
+            resident.push_back({entry.first, static_cast<std::size_t>(size.x) * size.y * 4, entry.second.use_count() - 1});
+        }
+    }
+    for (const auto& entry : fonts) {
+        if (!entry.second.font.expired()) {
+            resident.push_back({entry.first, entry.second.bytes, entry.second.font.use_count()});
+        }
+    }
+
+    std::sort(resident.begin(), resident.end(), [](const ResidentResource& a, const ResidentResource& b) {
+        return a.bytes > b.bytes;
+    });
+    return resident;
+}
+
+std::size_t ResourceCache::getResidentBytes() const {
+    std::size_t total = 0;
+    for (const auto& resource : getResidentResources()) {
+        total += resource.bytes;
+    }
+    return total;
+}
+
+void ResourceCache::printReport(std::ostream& out) const {
+    std::vector<ResidentResource> resident = getResidentResources();
+    std::size_t total = 0;
+
+    out << "Resident resources:\n";
+    for (const auto& resource : resident) {
+        out << "  " << std::setw(8) << resource.bytes / 1024 << " KiB  x" << resource.users << "  " << resource.path << "\n";
+        total += resource.bytes;
+    }
+    out << "  " << std::setw(8) << total / 1024 << " KiB  total (" << resident.size() << " resources)" << std::endl;
+}
@@ -4,17 +4,18 @@
 #include "../include/Enemy.hpp"
 #include "../include/Player.hpp"
 #include "../include/ButtonInteraction.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/Input.hpp"
+#include "../include/Profiler.hpp"
 
 #include <iostream>
 #include <cmath>
-#include <cstdlib>
 
 extern bool resetSentinelInteraction;
 
 // Constructor implementation
-SentinelInteraction::SentinelInteraction(sf::RenderWindow& window, sf::View& view, std::unique_ptr<Player>& player, std::unique_ptr<Enemy>& enemy)
-    : window(window),
-      view(view),
+SentinelInteraction::SentinelInteraction(const sf::View& view, std::unique_ptr<Player>& player, std::unique_ptr<Enemy>& enemy)
+    : view(view),
       player(player),
       enemy(enemy),
       questionVisible(false),
@@ -23,10 +24,12 @@ SentinelInteraction::SentinelInteraction(sf::RenderWindow& window, sf::View& vie
       responseComplete(false),
       awaitingFinalAnswer(false),
       sentinelHasAnswered(false),
-      rng(rd()),
-      dist(0, 1),
+      dialogueRandom(RandomService::get().getStream(RandomStreamId::SentinelDialogue)),
+      bossFightRandom(RandomService::get().getStream(RandomStreamId::BossFight)),
+      particleRandom(RandomService::get().getStream(RandomStreamId::VictoryParticles)),
       sentinelTruth(false),
-      messageDisplayDuration(sf::seconds(3.0f)),
+      messageDisplayTimer(3.0f),
+      messageDisplayDuration(3.0f),
       isCorrect(false),
       currentLevel(1),
       currentPattern(AttackPattern::DIRECT),
@@ -44,9 +47,7 @@ SentinelInteraction::SentinelInteraction(sf::RenderWindow& window, sf::View& vie
       waveComplete(false),
       waveTransitionTimer(0.0f)
 {
-    if (!font.loadFromFile("assets/fonts/Merriweather-Regular.ttf")) {
-        std::cerr << "Failed to load font\n";
-    }
+    font = ResourceCache::get().getFont("assets/fonts/Merriweather-Regular.ttf");
     
     healthBarBackground.setSize(sf::Vector2f(400.f, 20.f));
     healthBarBackground.setFillColor(sf::Color(100, 100, 100));
@@ -56,9 +57,11 @@ SentinelInteraction::SentinelInteraction(sf::RenderWindow& window, sf::View& vie
     healthBar.setFillColor(sf::Color::Red);
     healthBar.setPosition(760.f, 50.f);
 
-    playerOptions.setFont(font);
+    playerOptions.setFont(*font);
     playerOptions.setCharacterSize(24);
     playerOptions.setFillColor(sf::Color::White);
+
+    orbPalette = {sf::Color::Red, sf::Color::Magenta, sf::Color::Yellow, sf::Color::Cyan};
 }
 
 void SentinelInteraction::resetState() {
@@ -96,21 +99,23 @@ void SentinelInteraction::startLevel3Interaction() {
     currentLevel = 3;
 }
 
-void SentinelInteraction::triggerInteraction(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+void SentinelInteraction::triggerInteraction(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                              bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                                              const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
     if (currentLevel == 1) {
-        triggerInteractionLevel1(window, text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
+        triggerInteractionLevel1(text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
     } else if (currentLevel == 2) {
-        triggerInteractionLevel2(window, text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
+        triggerInteractionLevel2(text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
     } else if (currentLevel == 3) {
-        triggerInteractionLevel3(window, text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
+        triggerInteractionLevel3(text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
     }
 }
 
-void SentinelInteraction::triggerInteractionLevel1(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+void SentinelInteraction::triggerInteractionLevel1(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                                    bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                                                    const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
+    messageDisplayTimer += deltaTime;
+    dialogueOptionsVisible = false;
     if (!enemyTriggered) return;
 
     if (resetSentinelInteraction) {
@@ -123,22 +128,24 @@ void SentinelInteraction::triggerInteractionLevel1(sf::RenderWindow& window, sf:
         return;
     }
 
-    if (messageDisplayTimer.getElapsedTime() < messageDisplayDuration && messageDisplayTimer.getElapsedTime().asSeconds() != 0) {
+    if (messageDisplayTimer < messageDisplayDuration) {
         return;
     }
 
-    if (isCorrect && messageDisplayTimer.getElapsedTime() >= messageDisplayDuration) {
+    if (isCorrect && messageDisplayTimer >= messageDisplayDuration) {
         text.setString("");
         proceedToNextLevel = true;
         return;
     }
 
-    handleInitialInteraction(window, text, enemyTriggered, enemyDescending, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
+    handleInitialInteraction(text, enemyTriggered, enemyDescending, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
 }
 
-void SentinelInteraction::triggerInteractionLevel2(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+void SentinelInteraction::triggerInteractionLevel2(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                                    bool& enemySpawned, std::unique_ptr<Enemy>& enemy, float deltaTime,
                                                    const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
+    messageDisplayTimer += deltaTime;
+    dialogueOptionsVisible = false;
     (void)enemySpawned;
     if (!enemyTriggered) {
         text.setString("");
@@ -161,25 +168,27 @@ void SentinelInteraction::triggerInteractionLevel2(sf::RenderWindow& window, sf:
         return;
     }
 
-    if (messageDisplayTimer.getElapsedTime() < messageDisplayDuration && messageDisplayTimer.getElapsedTime().asSeconds() != 0) {
+    if (messageDisplayTimer < messageDisplayDuration) {
         return;
     }
 
-    if (isCorrect && messageDisplayTimer.getElapsedTime() >= messageDisplayDuration) {
+    if (isCorrect && messageDisplayTimer >= messageDisplayDuration) {
         text.setString("");
         proceedToNextLevel = true;
         return;
     }
 
-    handleInitialInteractionLevel2(window, text, enemyTriggered, enemyDescending, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
+    handleInitialInteractionLevel2(text, enemyTriggered, enemyDescending, enemy, deltaTime, playerPos, buttonInteraction, proceedToNextLevel);
 }
 
-void SentinelInteraction::triggerInteractionLevel3(sf::RenderWindow& window, sf::Text& text,
+void SentinelInteraction::triggerInteractionLevel3(sf::Text& text,
                                                    bool& enemyTriggered, bool& enemyDescending,
                                                    bool& enemySpawned, std::unique_ptr<Enemy>& enemy,
                                                    float deltaTime, const sf::Vector2f& playerPos,
                                                    ButtonInteraction& buttonInteraction,
                                                    bool& proceedToNextLevel) {
+    messageDisplayTimer += deltaTime;
+    dialogueOptionsVisible = false;
     (void)enemySpawned;
 
     if (!enemyTriggered) {
@@ -203,23 +212,22 @@ void SentinelInteraction::triggerInteractionLevel3(sf::RenderWindow& window, sf:
         return;
     }
 
-    if (messageDisplayTimer.getElapsedTime() < messageDisplayDuration &&
-        messageDisplayTimer.getElapsedTime().asSeconds() != 0) {
+    if (messageDisplayTimer < messageDisplayDuration) {
         return;
     }
 
-    if (isCorrect && messageDisplayTimer.getElapsedTime() >= messageDisplayDuration) {
+    if (isCorrect && messageDisplayTimer >= messageDisplayDuration) {
         text.setString("");
         proceedToNextLevel = true;
         return;
     }
 
-    handleInitialInteractionLevel3(window, text, enemyTriggered, enemyDescending,
+    handleInitialInteractionLevel3(text, enemyTriggered, enemyDescending,
                                    enemy, deltaTime, playerPos, buttonInteraction,
                                    proceedToNextLevel);
 }
 
-void SentinelInteraction::handleInitialInteraction(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+void SentinelInteraction::handleInitialInteraction(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                                    std::unique_ptr<Enemy>& enemy, float deltaTime,
                                                    const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
     // Level 1 interaction logic
@@ -240,9 +248,9 @@ void SentinelInteraction::handleInitialInteraction(sf::RenderWindow& window, sf:
         } else if (!responseComplete) {
             text.setString("Was the sentinel telling the truth? (Y/N)");
 
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Y)) {
+            if (isKeyPressed(sf::Keyboard::Y)) {
                 checkAnswer(true, text, enemyTriggered, buttonInteraction, proceedToNextLevel);
-            } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::N)) {
+            } else if (isKeyPressed(sf::Keyboard::N)) {
                 checkAnswer(false, text, enemyTriggered, buttonInteraction, proceedToNextLevel);
             }
         }
@@ -250,11 +258,11 @@ void SentinelInteraction::handleInitialInteraction(sf::RenderWindow& window, sf:
 
     if (awaitingResponse && !sentinelHasAnswered) {
         handleQuestionResponse(text);
-        window.draw(playerOptions);
+        dialogueOptionsVisible = true;
     }
 }
 
-void SentinelInteraction::handleInitialInteractionLevel2(sf::RenderWindow& window, sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
+void SentinelInteraction::handleInitialInteractionLevel2(sf::Text& text, bool& enemyTriggered, bool& enemyDescending,
                                                          std::unique_ptr<Enemy>& enemy, float deltaTime,
                                                          const sf::Vector2f& playerPos, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
     (void)enemyDescending;
@@ -271,8 +279,7 @@ void SentinelInteraction::handleInitialInteractionLevel2(sf::RenderWindow& windo
     }
 
     // Handle message display duration
-    if (messageDisplayTimer.getElapsedTime() < messageDisplayDuration &&
-        messageDisplayTimer.getElapsedTime().asSeconds() != 0) {
+    if (messageDisplayTimer < messageDisplayDuration) {
         return;
     }
 
@@ -286,22 +293,22 @@ void SentinelInteraction::handleInitialInteractionLevel2(sf::RenderWindow& windo
     } else if (!responseComplete) {
         text.setString("Was the sentinel telling the truth? (Y/N)");
 
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Y)) {
+        if (isKeyPressed(sf::Keyboard::Y)) {
             checkAnswerLevel2(true, text, enemyTriggered, buttonInteraction, proceedToNextLevel);
-            messageDisplayTimer.restart();
-        } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::N)) {
+            messageDisplayTimer = 0.0f;
+        } else if (isKeyPressed(sf::Keyboard::N)) {
             checkAnswerLevel2(false, text, enemyTriggered, buttonInteraction, proceedToNextLevel);
-            messageDisplayTimer.restart();
+            messageDisplayTimer = 0.0f;
         }
     }
 
     if (awaitingResponse && !sentinelHasAnswered) {
         handleQuestionResponseLevel2(text);
-        window.draw(playerOptions);
+        dialogueOptionsVisible = true;
     }
 }
 
-void SentinelInteraction::handleInitialInteractionLevel3(sf::RenderWindow& window, sf::Text& text, 
+void SentinelInteraction::handleInitialInteractionLevel3(sf::Text& text, 
                                                         bool& enemyTriggered, bool& enemyDescending,
                                                         std::unique_ptr<Enemy>& enemy, float deltaTime,
                                                         const sf::Vector2f& playerPos, 
@@ -332,64 +339,64 @@ void SentinelInteraction::handleInitialInteractionLevel3(sf::RenderWindow& windo
 
     if (awaitingResponse && !sentinelHasAnswered) {
         handleQuestionResponseLevel3(text);
-        window.draw(playerOptions);
+        dialogueOptionsVisible = true;
     }
 }
 
 void SentinelInteraction::handleQuestionResponse(sf::Text& text) {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Q)) {
+    if (isKeyPressed(sf::Keyboard::Q)) {
         questionVisible = false;
         ascent = true;
         awaitingResponse = false;
         text.setString("");
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::T) && !sentinelHasAnswered) {
-        sentinelTruth = dist(rng) == 1;
+    } else if (isKeyPressed(sf::Keyboard::T) && !sentinelHasAnswered) {
+        sentinelTruth = dialogueRandom.nextBool();
 
-        if (dist(rng) == 1) {
+        if (dialogueRandom.nextBool()) {
             text.setString("Yes, he would be lying.");
         } else {
             text.setString("No, he would not be lying.");
         }
-        messageDisplayTimer.restart();
+        messageDisplayTimer = 0.0f;
         sentinelHasAnswered = true;
         awaitingResponse = false;
     }
 }
 
 void SentinelInteraction::handleQuestionResponseLevel2(sf::Text& text) {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Q) && !sentinelHasAnswered) {
+    if (isKeyPressed(sf::Keyboard::Q) && !sentinelHasAnswered) {
         questionVisible = false;
         ascent = true;
         awaitingResponse = false;
         text.setString("");
         resetSentinelInteraction = true;
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::T) && !sentinelHasAnswered) {
-        if (dist(rng) == 1) {
+    } else if (isKeyPressed(sf::Keyboard::T) && !sentinelHasAnswered) {
+        if (dialogueRandom.nextBool()) {
             text.setString("Yes, the last sentinel lied to you.");
         } else {
             text.setString("No, the last sentinel was truthful.");
         }
-        messageDisplayTimer.restart();
+        messageDisplayTimer = 0.0f;
         sentinelHasAnswered = true;
         awaitingResponse = false;
     }
 }
 
 void SentinelInteraction::handleQuestionResponseLevel3(sf::Text& text) {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Q) && !sentinelHasAnswered) {
+    if (isKeyPressed(sf::Keyboard::Q) && !sentinelHasAnswered) {
         questionVisible = false;
         ascent = true;
         awaitingResponse = false;
         text.setString("");
         resetSentinelInteraction = true;
-    } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::T) && !sentinelHasAnswered) {
+    } else if (isKeyPressed(sf::Keyboard::T) && !sentinelHasAnswered) {
         text.setString("Prepare yourself...");
         text.setPosition(300, 600);
         inBossFight = true;
         countdown = 3;
         countdownTimer = 1.0f;
         spawnWaveGems();
-        messageDisplayTimer.restart();
+        messageDisplayTimer = 0.0f;
         sentinelHasAnswered = true;
         awaitingResponse = false;
     }
@@ -397,19 +404,19 @@ void SentinelInteraction::handleQuestionResponseLevel3(sf::Text& text) {
 
 void SentinelInteraction::checkAnswer(bool playerAnswer, sf::Text& text, bool& enemyTriggered, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
     (void)playerAnswer;
-    bool randomOutcome = dist(rng) == 1;
+    bool randomOutcome = dialogueRandom.nextBool();
 
     if (randomOutcome) {
         text.setString("Correct. You may proceed.");
         ascent = true;
         isCorrect = true;
         proceedToNextLevel = true;
-        messageDisplayTimer.restart();
+        messageDisplayTimer = 0.0f;
     } else {
         text.setString("Incorrect. Try again...");
         responseComplete = true;
         sentinelHasAnswered = false;
-        messageDisplayTimer.restart();
+        messageDisplayTimer = 0.0f;
         buttonInteraction.resetPrompt();
         enemyTriggered = false;
     }
@@ -418,7 +425,7 @@ void SentinelInteraction::checkAnswer(bool playerAnswer, sf::Text& text, bool& e
 void SentinelInteraction::checkAnswerLevel2(bool playerAnswer, sf::Text& text, bool& enemyTriggered, ButtonInteraction& buttonInteraction, bool& proceedToNextLevel) {
     (void)playerAnswer;
     (void)enemyTriggered;
-    bool randomOutcome = dist(rng) == 1;
+    bool randomOutcome = dialogueRandom.nextBool();
 
     if (randomOutcome) {
         text.setString("Correct. You may proceed.");
@@ -437,7 +444,7 @@ void SentinelInteraction::checkAnswerLevel3(bool playerAnswer, sf::Text& text,
                                             bool& proceedToNextLevel) {
     (void)playerAnswer;
     (void)enemyTriggered;
-    bool randomOutcome = dist(rng) == 1;
+    bool randomOutcome = dialogueRandom.nextBool();
 
     if (randomOutcome) {
         text.setString("Correct. You have proven yourself worthy.");
@@ -493,8 +500,8 @@ void SentinelInteraction::spawnGems() {
         gem.setFillColor(sf::Color::Yellow);
 
         // Random position within the level bounds
-        float x = SENTINEL_MIN_X + (std::rand() % static_cast<int>(SENTINEL_MAX_X - SENTINEL_MIN_X));
-        float y = 300.f + (std::rand() % 500); // Adjust these values based on your level
+        float x = SENTINEL_MIN_X + bossFightRandom.nextInt(static_cast<int>(SENTINEL_MAX_X - SENTINEL_MIN_X));
+        float y = 300.f + bossFightRandom.nextInt(500); // Adjust these values based on your level
 
         gem.setPosition(x, y);
         gems.push_back(gem);
@@ -503,13 +510,10 @@ void SentinelInteraction::spawnGems() {
 
 void SentinelInteraction::spawnOrbPattern(std::unique_ptr<Enemy>& enemy) {
     switch (currentPattern) {
-        case AttackPattern::DIRECT: {
-            Orb orb(10.f, AttackPattern::DIRECT);
-            orb.shape.setFillColor(sf::Color::Red);
-            orb.shape.setPosition(enemy->getPosition().x, enemy->getPosition().y + 50);
-            orbs.push_back(orb);
+        case AttackPattern::DIRECT:
+            orbs.spawn(enemy->getPosition().x, enemy->getPosition().y + 50, 0.0f,
+                       static_cast<std::uint8_t>(AttackPattern::DIRECT));
             break;
-        }
         case AttackPattern::SPIRAL:
             spawnSpiralOrbs(enemy);
             break;
@@ -529,11 +533,8 @@ void SentinelInteraction::spawnShotgunOrbs(std::unique_ptr<Enemy>& enemy) {
 
     for (int i = 0; i < SHOTGUN_COUNT; i++) {
         float angle = startAngle + (angleStep * i);
-        Orb orb(10.f, AttackPattern::SHOTGUN);
-        orb.shape.setFillColor(sf::Color::Yellow);
-        orb.shape.setPosition(enemy->getPosition().x, enemy->getPosition().y + 50);
-        orb.angle = angle;
-        orbs.push_back(orb);
+        orbs.spawn(enemy->getPosition().x, enemy->getPosition().y + 50, angle,
+                   static_cast<std::uint8_t>(AttackPattern::SHOTGUN));
     }
 }
 
@@ -541,20 +542,14 @@ void SentinelInteraction::spawnCrossOrbs(std::unique_ptr<Enemy>& enemy) {
     const std::vector<float> angles = {0, 45, 90, 135, 180, 225, 270, 315};
     
     for (float angle : angles) {
-        Orb orb(10.f, AttackPattern::CROSS);
-        orb.shape.setFillColor(sf::Color::Cyan);
-        orb.shape.setPosition(enemy->getPosition().x, enemy->getPosition().y + 50);
-        orb.angle = angle;
-        orbs.push_back(orb);
+        orbs.spawn(enemy->getPosition().x, enemy->getPosition().y + 50, angle,
+                   static_cast<std::uint8_t>(AttackPattern::CROSS));
     }
 }
 
 void SentinelInteraction::spawnSpiralOrbs(std::unique_ptr<Enemy>& enemy) {
-    Orb orb(10.f, AttackPattern::SPIRAL);
-    orb.shape.setFillColor(sf::Color::Magenta);
-    orb.shape.setPosition(enemy->getPosition().x, enemy->getPosition().y + 50);
-    orb.angle = spiralAngle;
-    orbs.push_back(orb);
+    orbs.spawn(enemy->getPosition().x, enemy->getPosition().y + 50, spiralAngle,
+               static_cast<std::uint8_t>(AttackPattern::SPIRAL));
     
     spiralAngle += 80.0f;
     if (spiralAngle >= 360.0f) {
@@ -564,6 +559,8 @@ void SentinelInteraction::spawnSpiralOrbs(std::unique_ptr<Enemy>& enemy) {
 
 
 void SentinelInteraction::updateBossFight(float deltaTime, std::unique_ptr<Enemy>& enemy, const sf::Vector2f& playerPos) {
+    VEX_PROFILE_SCOPE(BossFight);
+
     if (showVictoryScreen) {
         updateVictoryScreen(deltaTime);
         return;
@@ -627,7 +624,7 @@ void SentinelInteraction::updateBossFight(float deltaTime, std::unique_ptr<Enemy
     patternTimer -= deltaTime;
     if (patternTimer <= 0) {
         patternTimer = PATTERN_SWITCH_TIME * 1.5f; // More time between pattern changes
-        int pattern = std::rand() % 4;
+        int pattern = bossFightRandom.nextInt(4);
         currentPattern = static_cast<AttackPattern>(pattern);
     }
 
@@ -659,11 +656,11 @@ void SentinelInteraction::createVictoryParticles() {
     // Create celebration particles
     for (int i = 0; i < 100; ++i) {
         Particle particle;
-        particle.shape.setRadius(std::rand() % 5 + 2.0f);
+        particle.shape.setRadius(particleRandom.nextInt(5) + 2.0f);
         
         // Random colors for particles
         sf::Color particleColor;
-        switch (std::rand() % 4) {
+        switch (particleRandom.nextInt(4)) {
             case 0: particleColor = sf::Color::Yellow; break;
             case 1: particleColor = sf::Color(255, 215, 0); break;  // Gold
             case 2: particleColor = sf::Color(255, 140, 0); break;  // Dark Orange
@@ -674,11 +671,11 @@ void SentinelInteraction::createVictoryParticles() {
         particle.shape.setPosition(960.f, 540.f);  // Screen center
         
         // Random velocity
-        float angle = (std::rand() % 360) * 3.14159f / 180.f;
-        float speed = std::rand() % 300 + 200.0f;
+        float angle = particleRandom.nextInt(360) * 3.14159f / 180.f;
+        float speed = particleRandom.nextInt(300) + 200.0f;
         particle.velocity = sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed);
         
-        particle.lifetime = std::rand() % 3 + 2.0f;  // 2-5 seconds lifetime
+        particle.lifetime = particleRandom.nextInt(3) + 2.0f;  // 2-5 seconds lifetime
         particles.push_back(particle);
     }
 }
@@ -731,7 +728,7 @@ void SentinelInteraction::drawVictoryScreen(sf::RenderWindow& window) {
     
     // Draw victory text
     sf::Text victoryText;
-    victoryText.setFont(font);
+    victoryText.setFont(*font);
     victoryText.setString("VICTORY!");
     victoryText.setCharacterSize(100);
     victoryText.setFillColor(sf::Color(255, 215, 0, static_cast<sf::Uint8>(victoryScreenAlpha)));
@@ -749,7 +746,7 @@ void SentinelInteraction::drawVictoryScreen(sf::RenderWindow& window) {
     
     // Draw congratulatory message
     sf::Text congratsText;
-    congratsText.setFont(font);
+    congratsText.setFont(*font);
     congratsText.setString("You have defeated the Sentinel!");
     congratsText.setCharacterSize(40);
     congratsText.setFillColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(victoryScreenAlpha)));
@@ -768,65 +765,67 @@ void SentinelInteraction::drawVictoryScreen(sf::RenderWindow& window) {
 }
 
 void SentinelInteraction::handleOrbs(float deltaTime, const sf::Vector2f& playerPos) {
-    for (auto it = orbs.begin(); it != orbs.end();) {
-        sf::Vector2f orbPos = it->shape.getPosition();
-        float speed = orbSpeedPerWave[currentWave] * 0.7f; // Reduced orb speed
+    VEX_PROFILE_SCOPE(Orbs);
+
+    const float baseSpeed = orbSpeedPerWave[currentWave] * 0.7f; // Reduced orb speed
+    const float diameter = orbs.getRadius() * 2.0f;
 
-        // Pattern-specific behavior
-        switch (it->patternType) {
+    // Orbs die once they leave the camera rather than a fixed screen rectangle
+    const float visibleLeft = view.getCenter().x - view.getSize().x / 2.0f;
+    const float visibleTop = view.getCenter().y - view.getSize().y / 2.0f;
+    const float visibleRight = visibleLeft + view.getSize().x;
+    const float visibleBottom = visibleTop + view.getSize().y;
+
+    for (std::size_t i = 0; i < orbs.size();) {
+        float speed = baseSpeed;
+
+        // Pattern-specific behavior. Shotgun and cross orbs keep the direction
+        // they were spawned with.
+        switch (static_cast<AttackPattern>(orbs.pattern[i])) {
             case AttackPattern::DIRECT: {
                 // Slower homing speed
-                it->direction = playerPos - orbPos;
-                float length = std::sqrt(it->direction.x * it->direction.x + it->direction.y * it->direction.y);
+                float dx = playerPos.x - orbs.posX[i];
+                float dy = playerPos.y - orbs.posY[i];
+                float length = std::sqrt(dx * dx + dy * dy);
                 if (length != 0) {
-                    it->direction /= length;
+                    dx /= length;
+                    dy /= length;
                 }
+                orbs.dirX[i] = dx;
+                orbs.dirY[i] = dy;
                 speed *= 0.8f; // Even slower for homing orbs
                 break;
             }
             case AttackPattern::SHOTGUN:
-            case AttackPattern::CROSS: {
-                float angle = it->angle * 3.14159f / 180.0f;
-                it->direction = sf::Vector2f(std::cos(angle), std::sin(angle));
+            case AttackPattern::CROSS:
                 break;
-            }
             case AttackPattern::SPIRAL: {
-                it->angle += deltaTime * 270.0f; // Slower rotation
-                float angle = it->angle * 3.14159f / 180.0f;
-                it->direction = sf::Vector2f(std::cos(angle), std::sin(angle));
+                orbs.angle[i] += deltaTime * 270.0f; // Slower rotation
+                float angle = orbs.angle[i] * 3.14159f / 180.0f;
+                orbs.dirX[i] = std::cos(angle);
+                orbs.dirY[i] = std::sin(angle);
                 speed *= 0.9f;
                 break;
             }
         }
 
-        sf::Vector2f newPos = orbPos + it->direction * speed * deltaTime;
-        
-        // Bounds checking and collision
-        sf::FloatRect newOrbBounds = it->shape.getGlobalBounds();
-        newOrbBounds.left = newPos.x;
-        newOrbBounds.top = newPos.y;
-
-        bool collided = false;
-        for (const auto& platform : platforms) {
-            for (const auto& tile : platform.getTiles()) {
-                if (newOrbBounds.intersects(tile.getGlobalBounds())) {
-                    collided = true;
-                    break;
-                }
-            }
-            if (collided) break;
-        }
+        float newX = orbs.posX[i] + orbs.dirX[i] * speed * deltaTime;
+        float newY = orbs.posY[i] + orbs.dirY[i] * speed * deltaTime;
+
+        // Bounds checking and collision against the level's solid cells
+        bool collided = solidity.overlapsSolid(sf::FloatRect(newX, newY, diameter, diameter));
 
         // Remove orbs that are out of bounds or collided
         if (collided || 
-            newPos.y > 1080 || 
-            newPos.y < 0 || 
-            newPos.x < 0 || 
-            newPos.x > 1920) {
-            it = orbs.erase(it);
+            newY > visibleBottom || 
+            newY < visibleTop || 
+            newX < visibleLeft || 
+            newX > visibleRight) {
+            orbs.remove(i);
         } else {
-            it->shape.setPosition(newPos);
-            ++it;
+            orbs.posX[i] = newX;
+            orbs.posY[i] = newY;
+            ++i;
         }
     }
 }
@@ -857,13 +856,17 @@ void SentinelInteraction::checkGemCollision(const sf::Vector2f& playerPos) {
     }
 }
 
+void SentinelInteraction::drawDialogue(sf::RenderWindow& window) const {
+    if (dialogueOptionsVisible) window.draw(playerOptions);
+}
+
 void SentinelInteraction::drawBossFightElements(sf::RenderWindow& window) {
     if (!inBossFight) return;
 
     // Draw countdown if active
     if (countdown > 0) {
         sf::Text countdownText;
-        countdownText.setFont(font);
+        countdownText.setFont(*font);
         countdownText.setCharacterSize(72);
         countdownText.setFillColor(sf::Color::White);
         countdownText.setString(waveComplete ? "Wave " + std::to_string(currentWave + 1) :
@@ -874,7 +877,7 @@ void SentinelInteraction::drawBossFightElements(sf::RenderWindow& window) {
 
     // Draw wave number
     sf::Text waveText;
-    waveText.setFont(font);
+    waveText.setFont(*font);
     waveText.setCharacterSize(30);
     waveText.setFillColor(sf::Color::White);
     waveText.setString("Wave: " + std::to_string(currentWave + 1) + "/" + std::to_string(TOTAL_WAVES));
@@ -889,9 +892,9 @@ void SentinelInteraction::drawBossFightElements(sf::RenderWindow& window) {
         window.draw(gem);
     }
 
-    for (const auto& orb : orbs) {
-        window.draw(orb.shape); 
-    }
+    // Every orb goes out in one draw call
+    orbs.buildVertices(orbVertices, orbPalette);
+    window.draw(orbVertices);
 }
 
 void SentinelInteraction::handleAscentAndCleanup(std::unique_ptr<Enemy>& enemy, sf::Text& text, bool& enemyTriggered,
@@ -0,0 +1,97 @@
+#include "../include/SolidityGrid.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+SolidityGrid::SolidityGrid(float cellSize) : cellSize(cellSize) {}
+
+void SolidityGrid::build(const std::vector<sf::FloatRect>& solidBoxes) {
+    clear();
+    if (solidBoxes.empty()) return;
+
+    int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+    for (const auto& box : solidBoxes) {
+        minX = std::min(minX, toCell(box.left));
+        minY = std::min(minY, toCell(box.top));
+        maxX = std::max(maxX, toLastCell(box.left + box.width));
+        maxY = std::max(maxY, toLastCell(box.top + box.height));
+    }
+
+    originX = minX;
+    originY = minY;
+    width = maxX - minX + 1;
+    height = maxY - minY + 1;
+    solidBits.assign((static_cast<std::size_t>(width) * height + 63) / 64, 0);
+    partialBits.assign(solidBits.size(), 0);
+    boxes = solidBoxes;
+
+    for (std::uint32_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex) {
+        const sf::FloatRect& box = boxes[boxIndex];
+        for (int cellY = toCell(box.top); cellY <= toLastCell(box.top + box.height); ++cellY) {
+            for (int cellX = toCell(box.left); cellX <= toLastCell(box.left + box.width); ++cellX) {
+                std::size_t index = cellIndex(cellX, cellY);
+                bool coversCell = box.left <= cellX * cellSize && box.top <= cellY * cellSize &&
+                                  box.left + box.width >= (cellX + 1) * cellSize &&
+                                  box.top + box.height >= (cellY + 1) * cellSize;
+                if (coversCell) {
+                    solidBits[index / 64] |= std::uint64_t(1) << (index % 64);
+                } else {
+                    partialBits[index / 64] |= std::uint64_t(1) << (index % 64);
+                    partialCells[index].push_back(boxIndex);
+                }
+            }
+        }
+    }
+}
+
+void SolidityGrid::clear() {
+    originX = originY = 0;
+    width = height = 0;
+    solidBits.clear();
+    partialBits.clear();
+    boxes.clear();
+    partialCells.clear();
+}
+
+bool SolidityGrid::isSolidCell(int cellX, int cellY) const {
+    int x = cellX - originX;
+    int y = cellY - originY;
+    if (x < 0 || y < 0 || x >= width || y >= height) return false;
+
+    return testBit(solidBits, cellIndex(cellX, cellY));
+}
+
+bool SolidityGrid::overlapsSolid(const sf::FloatRect& area) const {
+    if (solidBits.empty()) return false;
+
+    int firstX = std::max(toCell(area.left), originX);
+    int firstY = std::max(toCell(area.top), originY);
+    int lastX = std::min(toLastCell(area.left + area.width), originX + width - 1);
+    int lastY = std::min(toLastCell(area.top + area.height), originY + height - 1);
+    for (int cellY = firstY; cellY <= lastY; ++cellY) {
+        for (int cellX = firstX; cellX <= lastX; ++cellX) {
+            std::size_t index = cellIndex(cellX, cellY);
+            if (testBit(solidBits, index)) return true;
+            if (!testBit(partialBits, index)) continue;
+
+            for (std::uint32_t boxIndex : partialCells.at(index)) {
+                if (area.intersects(boxes[boxIndex])) return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::size_t SolidityGrid::cellIndex(int cellX, int cellY) const {
+    return static_cast<std::size_t>(cellY - originY) * width + (cellX - originX);
+}
+
+int SolidityGrid::toCell(float coordinate) const {
+    return static_cast<int>(std::floor(coordinate / cellSize));
+}
+
+// Last cell touched by a half-open span ending at coordinate, so a tile that ends
+// exactly on a cell boundary doesn't mark the next cell.
+int SolidityGrid::toLastCell(float coordinate) const {
+    return static_cast<int>(std::ceil(coordinate / cellSize)) - 1;
+}
@@ -0,0 +1,123 @@
+#include "../include/TextureAtlas.hpp"
+#include <algorithm>
+#include <iostream>
+
+TextureAtlas::TextureAtlas(unsigned pageSize, unsigned padding)
+    : pageSize(pageSize), padding(padding) {}
+
+bool TextureAtlas::loadFromFiles(const std::vector<std::pair<AssetType, std::string>>& files) {
+    std::vector<sf::Image> decoded(files.size());
+    std::vector<std::pair<AssetType, const sf::Image*>> images;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (!decoded[i].loadFromFile(files[i].second)) {
+            std::cerr << "Error loading atlas texture from " << files[i].second << std::endl;
+            return false;
+        }
+        images.emplace_back(files[i].first, &decoded[i]);
+    }
+    return loadFromImages(images);
+}
+
+bool TextureAtlas::loadFromImages(const std::vector<std::pair<AssetType, const sf::Image*>>& images, bool upload) {
+    // Asking for the GL limit needs a context, so only when uploading
+    if (upload) pageSize = std::min(pageSize, sf::Texture::getMaximumSize());
+
+    struct Entry {
+        AssetType type;
+        const sf::Image* image;
+    };
+
+    std::vector<Entry> entries;
+    for (const auto& image : images) {
+        if (image.second->getSize().x + padding > pageSize || image.second->getSize().y + padding > pageSize) {
+            std::cerr << "Atlas texture " << getAssetTexturePath(image.first) << " does not fit in a " << pageSize << "px page" << std::endl;
+            return false;
+        }
+        entries.push_back({image.first, image.second});
+    }
+
+    // Shelf packing: tallest images first, left to right, starting a new shelf
+    // when the row is full and a new page when the shelves run out.
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.image->getSize().y > b.image->getSize().y;
+    });
+
+    std::vector<sf::Image> pageImages;
+    std::size_t pageCount = 0;
+    unsigned cursorX = 0;
+    unsigned shelfY = 0;
+    unsigned shelfHeight = 0;
+
+    regions.clear();
+    for (const auto& entry : entries) {
+        unsigned width = entry.image->getSize().x;
+        unsigned height = entry.image->getSize().y;
+
+        if (pageCount == 0 || cursorX + width + padding > pageSize) {
+            cursorX = 0;
+            shelfY += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (pageCount == 0 || shelfY + height + padding > pageSize) {
+            ++pageCount;
+            if (upload) {
+                pageImages.emplace_back();
+                pageImages.back().create(pageSize, pageSize, sf::Color::Transparent);
+            }
+            cursorX = 0;
+            shelfY = 0;
+            shelfHeight = 0;
+        }
+
+        if (upload) pageImages.back().copy(*entry.image, cursorX, shelfY);
+
+        std::size_t index = static_cast<std::size_t>(entry.type);
+        if (regions.size() <= index) {
+            regions.resize(index + 1);
+        }
+        regions[index].loaded = true;
+        regions[index].page = pageCount - 1;
+        regions[index].rect = sf::IntRect(cursorX, shelfY, width, height);
+
+        cursorX += width + padding;
+        shelfHeight = std::max(shelfHeight, height + padding);
+    }
+
+    pages.clear();
+    for (const auto& pageImage : pageImages) {
+        pages.push_back(std::make_unique<sf::Texture>());
+        if (!pages.back()->loadFromImage(pageImage)) {
+            std::cerr << "Error uploading texture atlas page" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const TextureAtlas::Region* TextureAtlas::findRegion(AssetType type) const {
+    std::size_t index = static_cast<std::size_t>(type);
+    if (index >= regions.size() || !regions[index].loaded) {
+        return nullptr;
+    }
+    return &regions[index];
+}
+
+bool TextureAtlas::contains(AssetType type) const {
+    return findRegion(type) != nullptr;
+}
+
+std::size_t TextureAtlas::getPage(AssetType type) const {
+    const Region* region = findRegion(type);
+    return region ? region->page : 0;
+}
+
+sf::IntRect TextureAtlas::getTextureRect(AssetType type) const {
+    const Region* region = findRegion(type);
+    return region ? region->rect : sf::IntRect();
+}
+
+sf::Vector2f TextureAtlas::getSize(AssetType type) const {
+    sf::IntRect rect = getTextureRect(type);
+    return sf::Vector2f(static_cast<float>(rect.width), static_cast<float>(rect.height));
+}
@@ -0,0 +1,119 @@
+#include "../include/TileLayer.hpp"
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+sf::FloatRect unite(const sf::FloatRect& a, const sf::FloatRect& b) {
+    if (a.width <= 0 && a.height <= 0) return b;
+    float left = std::min(a.left, b.left);
+    float top = std::min(a.top, b.top);
+    float right = std::max(a.left + a.width, b.left + b.width);
+    float bottom = std::max(a.top + a.height, b.top + b.height);
+    return sf::FloatRect(left, top, right - left, bottom - top);
+}
+
+} // namespace
+
+TileLayer::TileLayer(float cellSize) : chunkSize(cellSize * CHUNK_CELLS) {}
+
+void TileLayer::reset(const TextureAtlas& atlas) {
+    clear();
+    this->atlas = &atlas;
+}
+
+void TileLayer::clear() {
+    residentChunks.clear();
+}
+
+void TileLayer::updateResidency(const TileMap& tileMap, const sf::FloatRect& area) {
+    if (!atlas) return;
+
+    // Tiles belong to the chunk holding their top-left corner but can hang
+    // into the next one, hence the one-chunk margin on the load side.
+    int minX = toChunk(area.left) - 1;
+    int minY = toChunk(area.top) - 1;
+    int maxX = toChunk(area.left + area.width) + 1;
+    int maxY = toChunk(area.top + area.height) + 1;
+
+    for (int chunkY = minY; chunkY <= maxY; ++chunkY) {
+        for (int chunkX = minX; chunkX <= maxX; ++chunkX) {
+            GridKey key = TileMap::chunkKey(chunkX, chunkY);
+            if (residentChunks.count(key)) continue;
+            buildChunk(tileMap, chunkX, chunkY, residentChunks[key]);
+        }
+    }
+
+    // Unload one chunk further out than we load so standing on a chunk border
+    // doesn't rebuild the same chunk every frame.
+    for (auto chunkIt = residentChunks.begin(); chunkIt != residentChunks.end();) {
+        int chunkX = gridKeyX(chunkIt->first);
+        int chunkY = gridKeyY(chunkIt->first);
+        if (chunkX < minX - 1 || chunkX > maxX + 1 || chunkY < minY - 1 || chunkY > maxY + 1) {
+            chunkIt = residentChunks.erase(chunkIt);
+        } else {
+            ++chunkIt;
+        }
+    }
+}
+
+void TileLayer::invalidateCell(int cellX, int cellY) {
+    residentChunks.erase(TileMap::chunkKey(TileMap::toChunk(cellX), TileMap::toChunk(cellY)));
+}
+
+void TileLayer::buildChunk(const TileMap& tileMap, int chunkX, int chunkY, Chunk& chunk) const {
+    chunk.bounds = sf::FloatRect();
+    chunk.batches.clear();
+
+    sf::IntRect cells(chunkX * CHUNK_CELLS, chunkY * CHUNK_CELLS, CHUNK_CELLS, CHUNK_CELLS);
+    tileMap.forEachTileIn(cells, [&](const sf::Vector2f& position, AssetType type) {
+        if (!atlas->contains(type)) return;
+        if (chunk.batches.empty()) {
+            chunk.batches.resize(atlas->getPageCount());
+            for (std::size_t page = 0; page < chunk.batches.size(); ++page) {
+                chunk.batches[page].texture = &atlas->getTexture(page);
+                chunk.batches[page].vertices.setPrimitiveType(sf::Quads);
+            }
+        }
+        appendQuad(chunk, position, type);
+        chunk.bounds = unite(chunk.bounds, sf::FloatRect(position, atlas->getSize(type)));
+    });
+}
+
+void TileLayer::appendQuad(Chunk& chunk, const sf::Vector2f& pos, AssetType type) const {
+    sf::IntRect rect = atlas->getTextureRect(type);
+    float width = static_cast<float>(rect.width);
+    float height = static_cast<float>(rect.height);
+    float u = static_cast<float>(rect.left);
+    float v = static_cast<float>(rect.top);
+
+    sf::VertexArray& vertices = chunk.batches[atlas->getPage(type)].vertices;
+    vertices.append(sf::Vertex(pos, sf::Vector2f(u, v)));
+    vertices.append(sf::Vertex(sf::Vector2f(pos.x + width, pos.y), sf::Vector2f(u + width, v)));
+    vertices.append(sf::Vertex(sf::Vector2f(pos.x + width, pos.y + height), sf::Vector2f(u + width, v + height)));
+    vertices.append(sf::Vertex(sf::Vector2f(pos.x, pos.y + height), sf::Vector2f(u, v + height)));
+}
+
+void TileLayer::draw(sf::RenderWindow& window) const {
+    VEX_PROFILE_SCOPE(TileDraw);
+
+    const sf::View& view = window.getView();
+    sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+    for (const auto& entry : residentChunks) {
+        const Chunk& chunk = entry.second;
+        if (chunk.batches.empty() || !chunk.bounds.intersects(visible)) continue;
+
+        for (const auto& batch : chunk.batches) {
+            if (batch.vertices.getVertexCount() == 0) continue;
+            sf::RenderStates states;
+            states.texture = batch.texture;
+            window.draw(batch.vertices, states);
+        }
+    }
+}
+
+int TileLayer::toChunk(float coordinate) const {
+    return static_cast<int>(std::floor(coordinate / chunkSize));
+}
@@ -0,0 +1,98 @@
+#include "../include/TileMap.hpp"
+#include <algorithm>
+
+TileMap::TileMap(float cellSize) : cellSize(cellSize) {}
+
+void TileMap::build(const std::vector<std::pair<sf::Vector2f, AssetType>>& tiles) {
+    clear();
+    for (const auto& tile : tiles) {
+        sf::Vector2i cell = toCell(tile.first);
+        bool onGrid = tile.first.x == cell.x * cellSize && tile.first.y == cell.y * cellSize;
+        if (onGrid && get(cell.x, cell.y) == EMPTY) {
+            set(cell.x, cell.y, tile.second);
+        } else {
+            props.push_back({tile.first, tile.second});
+            growCellBounds(cell.x, cell.y);
+        }
+    }
+}
+
+void TileMap::clear() {
+    chunks.clear();
+    props.clear();
+    tileCount = 0;
+    cellBounds = sf::FloatRect();
+}
+
+std::vector<std::pair<sf::Vector2f, AssetType>> TileMap::toTileList() const {
+    std::vector<std::pair<sf::Vector2f, AssetType>> tiles;
+    tiles.reserve(getTileCount());
+    forEachTile([&](const sf::Vector2f& position, AssetType type) { tiles.emplace_back(position, type); });
+    return tiles;
+}
+
+TileMap::TileId TileMap::get(int cellX, int cellY) const {
+    const Chunk* chunk = findChunk(toChunk(cellX), toChunk(cellY));
+    if (!chunk) return EMPTY;
+    int localX = cellX - toChunk(cellX) * CHUNK_CELLS;
+    int localY = cellY - toChunk(cellY) * CHUNK_CELLS;
+    return chunk->ids[localY * CHUNK_CELLS + localX];
+}
+
+bool TileMap::set(int cellX, int cellY, AssetType type) {
+    Chunk& chunk = chunks[chunkKey(toChunk(cellX), toChunk(cellY))];
+    int localX = cellX - toChunk(cellX) * CHUNK_CELLS;
+    int localY = cellY - toChunk(cellY) * CHUNK_CELLS;
+    TileId& id = chunk.ids[localY * CHUNK_CELLS + localX];
+    TileId newId = static_cast<TileId>(type);
+    if (id == newId) return false;
+
+    if (id == EMPTY) {
+        ++chunk.tileCount;
+        ++tileCount;
+    }
+    id = newId;
+    growCellBounds(cellX, cellY);
+    return true;
+}
+
+bool TileMap::erase(int cellX, int cellY) {
+    auto chunkIt = chunks.find(chunkKey(toChunk(cellX), toChunk(cellY)));
+    if (chunkIt == chunks.end()) return false;
+
+    int localX = cellX - toChunk(cellX) * CHUNK_CELLS;
+    int localY = cellY - toChunk(cellY) * CHUNK_CELLS;
+    TileId& id = chunkIt->second.ids[localY * CHUNK_CELLS + localX];
+    if (id == EMPTY) return false;
+
+    id = EMPTY;
+    --tileCount;
+    if (--chunkIt->second.tileCount == 0) chunks.erase(chunkIt);
+    return true;
+}
+
+const TileMap::Chunk* TileMap::findChunk(int chunkX, int chunkY) const {
+    auto chunkIt = chunks.find(chunkKey(chunkX, chunkY));
+    return chunkIt == chunks.end() ? nullptr : &chunkIt->second;
+}
+
+sf::Vector2i TileMap::toCell(const sf::Vector2f& position) const {
+    return sf::Vector2i(static_cast<int>(std::floor(position.x / cellSize)), static_cast<int>(std::floor(position.y / cellSize)));
+}
+
+std::size_t TileMap::getMemoryBytes() const {
+    return chunks.size() * (sizeof(Chunk) + sizeof(GridKey)) + props.capacity() * sizeof(Prop);
+}
+
+void TileMap::growCellBounds(int cellX, int cellY) {
+    sf::FloatRect cell(cellX * cellSize, cellY * cellSize, cellSize, cellSize);
+    if (cellBounds.width <= 0 && cellBounds.height <= 0) {
+        cellBounds = cell;
+        return;
+    }
+    float left = std::min(cellBounds.left, cell.left);
+    float top = std::min(cellBounds.top, cell.top);
+    float right = std::max(cellBounds.left + cellBounds.width, cell.left + cell.width);
+    float bottom = std::max(cellBounds.top + cellBounds.height, cell.top + cell.height);
+    cellBounds = sf::FloatRect(left, top, right - left, bottom - top);
+}
@@ -1,4 +1,6 @@
 #include "../include/TitleScreen.hpp"
+#include "../include/Input.hpp"
+#include "../include/ResourceCache.hpp"
 #include <stdexcept>
 
 TitleScreen::TitleScreen(sf::RenderWindow& window)
@@ -9,11 +11,12 @@ TitleScreen::TitleScreen(sf::RenderWindow& window)
 }
 
 void TitleScreen::loadAssets() {
-    if (!font.loadFromFile("assets/fonts/gothic.ttf")) {
+    font = ResourceCache::get().getFont("assets/fonts/gothic.ttf");
+    if (font->getInfo().family.empty()) {
         throw std::runtime_error("Could not load font: assets/fonts/gothic.ttf");
     }
 
-    gameTitle.setFont(font);
+    gameTitle.setFont(*font);
     gameTitle.setString("veX");
     gameTitle.setCharacterSize(80);
     gameTitle.setFillColor(sf::Color::White);
@@ -23,7 +26,7 @@ void TitleScreen::loadAssets() {
 
     std::string options[] = { "Start Game", "Options", "Exit" };
     for (int i = 0; i < 3; ++i) {
-        menuOptions[i].setFont(font);
+        menuOptions[i].setFont(*font);
         menuOptions[i].setString(options[i]);
         menuOptions[i].setCharacterSize(40);
         menuOptions[i].setFillColor(sf::Color::White);
@@ -36,17 +39,17 @@ void TitleScreen::loadAssets() {
 void TitleScreen::handleInput() {
     static sf::Clock clock;
     if (clock.getElapsedTime().asSeconds() > 0.2f) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down)) {
+        if (isKeyPressed(sf::Keyboard::Down)) {
             currentSelection = (currentSelection + 1) % 3;
             clock.restart();
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up)) {
+        if (isKeyPressed(sf::Keyboard::Up)) {
             currentSelection = (currentSelection - 1 + 3) % 3;
             clock.restart();
         }
     }
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter)) {
+    if (isKeyPressed(sf::Keyboard::Enter)) {
         if (currentSelection == 0) {
         } else if (currentSelection == 1) {
         } else if (currentSelection == 2) {
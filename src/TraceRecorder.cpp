@@ -0,0 +1,127 @@
+#include "../include/TraceRecorder.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+std::int64_t microseconds(TraceRecorder::Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+// Event names are our own literals, but keep the JSON valid whatever they hold
+void writeJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') out << '\\';
+        if (static_cast<unsigned char>(*c) >= 0x20) out << *c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+TraceRecorder& TraceRecorder::get() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::ThreadSlot::~ThreadSlot() {
+    if (!buffer) return;
+    std::lock_guard<std::mutex> lock(TraceRecorder::get().buffersMutex);
+    buffer->retired = true;
+}
+
+void TraceRecorder::start() {
+    if (isRecording()) return;
+
+    {
+        // Buffers of threads that have exited were read by the last stop()
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                                     [](const std::unique_ptr<ThreadBuffer>& buffer) { return buffer->retired; }),
+                      buffers.end());
+    }
+
+    sessionStart.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    session.fetch_add(1, std::memory_order_relaxed);
+    recording.store(true, std::memory_order_release);
+}
+
+bool TraceRecorder::stop(const std::string& path) {
+    if (!isRecording()) return false;
+    recording.store(false, std::memory_order_release);
+
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Failed to open trace file " << path << std::endl;
+        return false;
+    }
+
+    unsigned currentSession = session.load(std::memory_order_relaxed);
+    std::size_t written = 0;
+    std::size_t dropped = 0;
+    bool first = true;
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (const auto& buffer : buffers) {
+        if (buffer->session.load(std::memory_order_acquire) != currentSession) continue;
+        std::size_t count = buffer->count.load(std::memory_order_acquire);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const Event& event = buffer->events[i];
+            file << (first ? "" : ",\n") << "{\"name\":";
+            writeJsonString(file, event.name);
+            file << ",\"ph\":\"X\",\"ts\":" << event.beginUs << ",\"dur\":" << event.durationUs
+                 << ",\"pid\":1,\"tid\":" << buffer->threadId << "}";
+            first = false;
+        }
+        written += count;
+    }
+    file << "\n]}\n";
+
+    if (!file) {
+        std::cerr << "Failed to write trace file " << path << std::endl;
+        return false;
+    }
+    std::cout << "Trace: " << written << " events written to " << path;
+    if (dropped > 0) std::cout << " (" << dropped << " dropped, buffers full)";
+    std::cout << std::endl;
+    return true;
+}
+
+void TraceRecorder::record(const char* name, Clock::time_point begin, Clock::time_point end) {
+    if (!isRecording()) return;
+
+    ThreadBuffer& buffer = threadBuffer();
+    unsigned currentSession = session.load(std::memory_order_relaxed);
+    if (buffer.session.load(std::memory_order_relaxed) != currentSession) {
+        // First event of a new recording: forget the old one before claiming the buffer for it
+        buffer.count.store(0, std::memory_order_relaxed);
+        buffer.dropped.store(0, std::memory_order_relaxed);
+        buffer.session.store(currentSession, std::memory_order_release);
+    }
+
+    std::size_t count = buffer.count.load(std::memory_order_relaxed);
+    if (count == EVENTS_PER_THREAD) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Clock::time_point start{Clock::duration(sessionStart.load(std::memory_order_relaxed))};
+    buffer.events[count] = Event{name, microseconds(begin - start), microseconds(end - begin)};
+    buffer.count.store(count + 1, std::memory_order_release);
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::threadBuffer() {
+    thread_local ThreadSlot slot;
+    if (!slot.buffer) {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        slot.buffer = buffers.back().get();
+        slot.buffer->threadId = nextThreadId++;
+    }
+    return *slot.buffer;
+}
@@ -3,148 +3,296 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics.hpp>
 #include <iostream>
+#include <string>
 #include <vector>
+#include <algorithm>
 #include <memory>
+#include <cstdlib>
 #include <cmath>
-#include <map>
-#include <fstream>
 #include <chrono>
+#include <cstdint>
 #include <random>
 #include <SFML/Audio.hpp>
 #include "../include/TitleScreen.hpp"
-#include "../include/nfd.h"
 #include "../include/Player.hpp"
 #include "../include/Enemy.hpp"
+#include "../include/GameSession.hpp"
 #include "../include/Background.hpp"
-#include "../include/Platform.hpp"
-#include <X11/Xlib.h>
-#include <X11/extensions/XTest.h>
-#include <X11/cursorfont.h>
+#include "../include/LevelIO.hpp"
+#include "../include/ResourceCache.hpp"
+#include "../include/AssetLoader.hpp"
+#include "../include/CursorManager.hpp"
+#include "../include/Input.hpp"
+#include "../include/InputRecording.hpp"
+#include "../include/LevelBrowser.hpp"
+#include "../include/LevelEditor.hpp"
+#include "../include/LevelStreamer.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/RandomService.hpp"
+#include "../include/TraceRecorder.hpp"
+#include "../include/TextureAtlas.hpp"
+#include "../include/TileLayer.hpp"
 #include "AssetType.hpp"
 #include "../include/ButtonInteraction.hpp"
 #include "../include/SentinelInteraction.hpp"
 
-void enableMouse();
-void disableMouse();
-
 enum class GameMode { Play, Edit };
 enum class GameState { Title, Play, Victory, Exit };
-
-bool isValidAssetType(int assetTypeInt) {
-    return assetTypeInt >= static_cast<int>(AssetType::Brick) &&
-           assetTypeInt <= static_cast<int>(AssetType::Statue3);
+enum class InputCapture { Off, Waiting, Recording, Replaying };
+
+// Gameplay advances in fixed 120 Hz steps regardless of the display rate. After a
+// hitch at most MAX_SIMULATION_STEPS_PER_FRAME steps are caught up and the rest of
+// the backlog is dropped, so a stall can't turn into one huge step.
+const float SIMULATION_STEP = 1.0f / 120.0f;
+const int MAX_SIMULATION_STEPS_PER_FRAME = 8;
+
+// Recorded and replayed frames always advance the game by exactly this many
+// steps instead of following the clock, so a replay goes through the same
+// steps as the run it was recorded from
+const int RECORDED_STEPS_PER_FRAME = 2;
+const float RECORDED_FRAME_TIME = RECORDED_STEPS_PER_FRAME * SIMULATION_STEP;
+
+// Editor camera pan speed in pixels per second
+const float CAMERA_PAN_SPEED = 1200.0f;
+
+// Frames a --headless run simulates unless --frames says otherwise
+const int DEFAULT_HEADLESS_FRAMES = 36000;
+
+// Where F4 writes traces unless --trace names a file
+const char* const DEFAULT_TRACE_PATH = "vex_trace.json";
+
+// Where --record writes unless it names a file
+const char* const DEFAULT_RECORDING_PATH = "vex_input.vexr";
+
+// Textures every run needs before the title screen: background sets, then the character sheets
+const char* const STARTUP_TEXTURES[] = {
+    "assets/tutorial_level/background.png",
+    "assets/tutorial_level/middleground.png",
+    "assets/tutorial_level/mountains.png",
+    "assets/level2/background.png",
+    "assets/level2/middleground.png",
+    "assets/level2/foreground.png",
+    "assets/level3/clouds.png",
+    "assets/level3/town.png",
+    "assets/characters/player/veX_sprite_sheet.png",
+    "assets/characters/player/veX_breathe_sheet.png",
+    "assets/characters/player/veX_jump.png",
+    "assets/characters/player/veX_death.png",
+    "assets/characters/enemies/wrathborn_sprite_sheet.png",
+};
+
+sf::FloatRect getVisibleArea(const sf::View& view) {
+    return sf::FloatRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
 }
 
-void drawGrid(sf::RenderWindow& window, const sf::Vector2f& viewSize, float gridSize) {
+void drawGrid(sf::RenderWindow& window, const sf::View& view, float gridSize) {
+    sf::FloatRect area = getVisibleArea(view);
+    float left = std::floor(area.left / gridSize) * gridSize;
+    float top = std::floor(area.top / gridSize) * gridSize;
+    float right = area.left + area.width;
+    float bottom = area.top + area.height;
+
     sf::VertexArray lines(sf::Lines);
-    for (float y = 0; y < viewSize.y; y += gridSize) {
-        lines.append(sf::Vertex(sf::Vector2f(0, y), sf::Color(255, 255, 255, 100)));
-        lines.append(sf::Vertex(sf::Vector2f(viewSize.x, y), sf::Color(255, 255, 255, 100)));
+    for (float y = top; y < bottom; y += gridSize) {
+        lines.append(sf::Vertex(sf::Vector2f(left, y), sf::Color(255, 255, 255, 100)));
+        lines.append(sf::Vertex(sf::Vector2f(right, y), sf::Color(255, 255, 255, 100)));
     }
-    for (float x = 0; x < viewSize.x; x += gridSize) {
-        lines.append(sf::Vertex(sf::Vector2f(x, 0), sf::Color(255, 255, 255, 100)));
-        lines.append(sf::Vertex(sf::Vector2f(x, viewSize.y), sf::Color(255, 255, 255, 100)));
+    for (float x = left; x < right; x += gridSize) {
+        lines.append(sf::Vertex(sf::Vector2f(x, top), sf::Color(255, 255, 255, 100)));
+        lines.append(sf::Vertex(sf::Vector2f(x, bottom), sf::Color(255, 255, 255, 100)));
     }
     window.draw(lines);
 }
 
-void saveLevel(sf::RenderWindow& window, const std::vector<std::pair<sf::Vector2f, AssetType>>& tilePositions) {
-    enableMouse();
-    window.create(sf::VideoMode(1280, 720), "veX - Saving...", sf::Style::Close);
-    nfdchar_t* outPath = nullptr;
-    nfdresult_t result = NFD_SaveDialog("txt", nullptr, &outPath);
-    if (result == NFD_OKAY) {
-        std::ofstream outFile(outPath);
-        for (const auto& tileData : tilePositions) {
-            outFile << tileData.first.x << " " << tileData.first.y << " " << static_cast<int>(tileData.second) << "\n";
-        }
-        outFile.close();
+// One frame of a recording or replay, with that frame's input already set
+void advanceRecordedFrame(GameSession& session) {
+    for (int step = 0; step < RECORDED_STEPS_PER_FRAME; ++step) {
+        session.step(SIMULATION_STEP);
     }
-    window.create(sf::VideoMode(1920, 1080), "veX", sf::Style::Fullscreen);
-    disableMouse();
+    session.update(RECORDED_FRAME_TIME);
 }
 
-std::vector<std::pair<sf::Vector2f, AssetType>> loadLevelFromFile(const std::string& filepath, std::vector<Platform>& platforms,
-                                                                  const std::map<AssetType, sf::Texture>& textures) {
-    std::vector<std::pair<sf::Vector2f, AssetType>> tiles;
-    std::ifstream inFile(filepath);
-    float x, y;
-    int assetTypeInt;
-    platforms.clear();
-    while (inFile >> x >> y >> assetTypeInt) {
-        if (!isValidAssetType(assetTypeInt)) continue;
-        sf::Vector2f pos(x, y);
-        AssetType assetType = static_cast<AssetType>(assetTypeInt);
-        tiles.emplace_back(pos, assetType);
-        auto textureIt = textures.find(assetType);
-        if (textureIt != textures.end()) {
-            const sf::Texture& tileTexture = textureIt->second;
-            sf::Vector2f size(tileTexture.getSize().x, tileTexture.getSize().y);
-            bool isGrassy = (assetType == AssetType::Grassy || assetType == AssetType::Ground || assetType == AssetType::Ground3);
-            if (assetType != AssetType::Tree && assetType != AssetType::Button && assetType != AssetType::Statue3) {
-                platforms.emplace_back(pos.x, pos.y, size.x, size.y, tileTexture, isGrassy);
-            }
-        }
+void printReplayResult(const InputRecording& recording, std::size_t replayedFrames, std::uint64_t checksum) {
+    std::cout << "Replayed " << replayedFrames << " of " << recording.getFrameCount() << " frames, checksum "
+              << std::hex << checksum << std::dec;
+    if (replayedFrames < recording.getFrameCount()) {
+        std::cout << " (stopped early, not compared)" << std::endl;
+    } else if (checksum == recording.getChecksum()) {
+        std::cout << " (matches the recording)" << std::endl;
+    } else {
+        std::cout << " (MISMATCH, recorded " << std::hex << recording.getChecksum() << std::dec << ")" << std::endl;
     }
-    inFile.close();
-    return tiles;
 }
 
-std::vector<std::pair<sf::Vector2f, AssetType>> loadLevel(sf::RenderWindow& window, std::vector<Platform>& platforms,
-                                                          const std::map<AssetType, sf::Texture>& textures, bool isDefault = false) {
-    enableMouse();
-    window.create(sf::VideoMode(1280, 720), "veX - Loading...", sf::Style::Close);
-    std::vector<std::pair<sf::Vector2f, AssetType>> tiles;
-    if (isDefault) {
-        tiles = loadLevelFromFile("levels/level1.txt", platforms, textures);
-    } else {
-        nfdchar_t* outPath = nullptr;
-        nfdresult_t result = NFD_OpenDialog("txt", nullptr, &outPath);
-        if (result == NFD_OKAY) {
-            tiles = loadLevelFromFile(outPath, platforms, textures);
+// Saves a recording with the run's checksum, or reports how a replay compared
+void finishInputCapture(InputCapture& capture, InputRecording& recording, const std::string& recordingPath,
+                        std::size_t replayedFrames, std::uint64_t checksum) {
+    if (capture == InputCapture::Recording) {
+        recording.setChecksum(checksum);
+        if (recording.saveToFile(recordingPath)) {
+            std::cout << "Recorded " << recording.getFrameCount() << " frames to " << recordingPath << ", checksum "
+                      << std::hex << checksum << std::dec << std::endl;
         }
+    } else if (capture == InputCapture::Replaying) {
+        printReplayResult(recording, replayedFrames, checksum);
     }
-    window.create(sf::VideoMode(1920, 1080), "veX", sf::Style::Fullscreen);
-    disableMouse();
-    return tiles;
+    capture = InputCapture::Off;
 }
 
-void updateView(sf::RenderWindow& window, sf::View& view) {
-    float baseWidth = 1920.0f;
-    float baseHeight = 1080.0f;
-    view.setViewport(sf::FloatRect(0.0f, 0.0f, 1.0f, 1.0f));
-    view.setSize(baseWidth, baseHeight);
-    window.setView(view);
-}
+// Steps a session as fast as the simulation runs, with no window, GL context
+// or display. Textures are never loaded; the atlas is laid out from the decoded
+// images only so tile sizes (and with them collision) match a normal run.
+// With a replay the recorded frames are played back instead of idle ones.
+int runHeadless(int frames, bool bossFight, const InputRecording* replay) {
+    ResourceCache::get().setGraphicsEnabled(false);
+    setKeyboardEnabled(false);
+
+    AssetLoader assetLoader;
+    for (const AssetInfo& info : ASSET_INFO) {
+        assetLoader.addImage(info.texturePath);
+    }
+    assetLoader.run();
+
+    std::vector<std::pair<AssetType, const sf::Image*>> atlasImages;
+    for (const AssetInfo& info : ASSET_INFO) {
+        const sf::Image* image = assetLoader.getImage(info.texturePath);
+        if (!image) {
+            std::cerr << "Failed to load textures" << std::endl;
+            return -1;
+        }
+        atlasImages.emplace_back(info.type, image);
+    }
 
-void disableMouse() {
-    Display* display = XOpenDisplay(nullptr);
-    Window root = DefaultRootWindow(display);
-    Cursor invisibleCursor;
-    Pixmap bitmapNoData;
-    XColor black;
-    static char noData[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
-    black.red = black.green = black.blue = 0;
-    bitmapNoData = XCreateBitmapFromData(display, root, noData, 8, 8);
-    invisibleCursor = XCreatePixmapCursor(display, bitmapNoData, bitmapNoData, &black, &black, 0, 0);
-    XDefineCursor(display, root, invisibleCursor);
-    XFreeCursor(display, invisibleCursor);
-    XFreePixmap(display, bitmapNoData);
-    XFlush(display);
-    XCloseDisplay(display);
+    TextureAtlas atlas;
+    if (!atlas.loadFromImages(atlasImages, false)) {
+        std::cerr << "Failed to load textures" << std::endl;
+        return -1;
+    }
+    assetLoader.releaseImages();
+
+    GameSession session(atlas);
+    if (bossFight || (replay && replay->startsAtBossFight())) session.startBossFight();
+
+    if (replay) frames = static_cast<int>(replay->getFrameCount());
+    std::uint64_t checksum = GameSession::CHECKSUM_SEED;
+    std::vector<float> frameMs(frames);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        auto frameStart = std::chrono::steady_clock::now();
+        if (replay) {
+            setInputFrame(replay->getFrame(frame));
+            advanceRecordedFrame(session);
+            checksum = session.getChecksum(checksum);
+            session.moveCamera(session.getPlayerFocusX(0.0f));
+        } else {
+            session.step(SIMULATION_STEP);
+            session.update(SIMULATION_STEP);
+            session.moveCamera(session.getPlayerFocusX(1.0f));
+        }
+        frameMs[frame] = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        VEX_PROFILE_FRAME();
+    }
+    float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+    float frameTime = replay ? RECORDED_FRAME_TIME : SIMULATION_STEP;
+    std::cout << "Simulated " << frames << " frames (" << frames * frameTime << " s of game time) in "
+              << seconds << " s, " << (seconds > 0 ? frames / seconds : 0.0f) << " frames/s\n"
+              << "  level " << session.getCurrentLevel() << ", player health " << session.getPlayer().getHealth()
+              << ", " << session.getSentinelInteraction().getOrbCount() << " orbs"
+              << (session.isVictorious() ? ", boss defeated" : "") << ", seed " << RandomService::get().getSeed() << std::endl;
+
+    if (frames > 0) {
+        float worstMs = *std::max_element(frameMs.begin(), frameMs.end());
+        auto p99 = frameMs.begin() + (frames - 1) * 99 / 100;
+        std::nth_element(frameMs.begin(), p99, frameMs.end());
+        std::cout << "  frame ms: avg " << seconds * 1000.0f / frames << ", p99 " << *p99 << ", worst " << worstMs << std::endl;
+    }
+    if (replay) printReplayResult(*replay, static_cast<std::size_t>(frames), checksum);
+    return 0;
 }
 
-void enableMouse() {
-    Display* display = XOpenDisplay(nullptr);
-    Window root = DefaultRootWindow(display);
-    XUndefineCursor(display, root);
-    XFlush(display);
-    XCloseDisplay(display);
-}
+int main(int argc, char* argv[]) {
+    // --trace [file] records a Chrome trace from startup until F4 or exit.
+    // --headless [--frames N] [--boss-fight] simulates without opening a window.
+    // --boss-fight on its own skips the title screen and the story.
+    // --record [file] records the input from the start of play until the game
+    // leaves it (victory, editor, level browser or exit); --replay file plays a
+    // recording back, in a window or with --headless, and checks its checksum.
+    // --seed N fixes the random seed; by default headless runs use
+    // RandomService::DEFAULT_SEED, windowed ones a fresh seed, and replays the
+    // recording's.
+    std::string tracePath = DEFAULT_TRACE_PATH;
+    std::string recordingPath = DEFAULT_RECORDING_PATH;
+    std::string replayPath;
+    bool headless = false;
+    bool bossFight = false;
+    bool recordInput = false;
+    bool seedGiven = false;
+    std::uint64_t seed = RandomService::DEFAULT_SEED;
+    int headlessFrames = DEFAULT_HEADLESS_FRAMES;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--trace") {
+            if (i + 1 < argc && argv[i + 1][0] != '-') tracePath = argv[++i];
+            TraceRecorder::get().start();
+        } else if (arg == "--headless") {
+            headless = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            headlessFrames = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--boss-fight") {
+            bossFight = true;
+        } else if (arg == "--record") {
+            if (i + 1 < argc && argv[i + 1][0] != '-') recordingPath = argv[++i];
+            recordInput = true;
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+            seedGiven = true;
+        }
+    }
+
+    InputRecording inputRecording;
+    InputCapture inputCapture = recordInput ? InputCapture::Waiting : InputCapture::Off;
+    if (!replayPath.empty()) {
+        if (!inputRecording.loadFromFile(replayPath)) return -1;
+        inputCapture = InputCapture::Replaying;
+        bossFight = inputRecording.startsAtBossFight();
+        seed = inputRecording.getSeed();
+    } else if (!seedGiven && !headless) {
+        std::random_device randomDevice;
+        seed = (static_cast<std::uint64_t>(randomDevice()) << 32) | randomDevice();
+    }
+    // Nothing draws a random number before the first frame of play, so a
+    // recording made from this seed replays from the same stream states.
+    RandomService::get().seed(seed);
+
+    if (headless) {
+        int result = runHeadless(headlessFrames, bossFight, inputCapture == InputCapture::Replaying ? &inputRecording : nullptr);
+        if (TraceRecorder::get().isRecording()) TraceRecorder::get().stop(tracePath);
+        return result;
+    }
 
-int main() {
-    sf::RenderWindow window(sf::VideoMode(1920, 1080), "veX", sf::Style::Fullscreen);
+    sf::RenderWindow window;
+    {
+        VEX_TRACE_SCOPE("Create window");
+        window.create(sf::VideoMode(1920, 1080), "veX", sf::Style::Fullscreen);
+    }
     window.setFramerateLimit(60);
+    CursorManager cursor(window);
+
+    // Decode all startup images in parallel up front; the constructors below then
+    // pick their textures out of the ResourceCache, where the loader keeps them pinned.
+    AssetLoader assetLoader;
+    for (const AssetInfo& info : ASSET_INFO) {
+        assetLoader.addImage(info.texturePath);
+    }
+    for (const char* path : STARTUP_TEXTURES) {
+        assetLoader.addTexture(path);
+    }
+    assetLoader.run();
+    assetLoader.printReport(std::cout);
 
     sf::Music backgroundMusic;
     if (!backgroundMusic.openFromFile("assets/song.mp3")) {  // or .ogg file
@@ -155,21 +303,8 @@ int main() {
         backgroundMusic.play();
     }
 
-    sf::Font font;
-    if (!font.loadFromFile("assets/fonts/Merriweather-Regular.ttf")) {
-        std::cerr << "Failed to load font\n";
-    }
+    std::shared_ptr<sf::Font> font = ResourceCache::get().getFont("assets/fonts/Merriweather-Regular.ttf");
 
-    sf::Text text;
-    text.setFont(font);
-    text.setCharacterSize(24);
-    text.setFillColor(sf::Color::White);
-
-    sf::View view(sf::FloatRect(0, 0, 1920, 1080));
-    window.setView(view);
-
-    std::unique_ptr<Player> player = std::make_unique<Player>(0, 950);
-    std::unique_ptr<Enemy> enemy = std::make_unique<Enemy>(1600, -500);
     TitleScreen titleScreen(window);
 
     GameState gameState = GameState::Title;
@@ -177,32 +312,25 @@ int main() {
     sf::Clock clock;
     bool debugMode = false;
     const float gridSize = 64.0f;
-    std::vector<Platform> platforms;
-    
-    bool playerJustReset = false;
 
     AssetType currentAsset = AssetType::Brick;
 
-    std::map<AssetType, sf::Texture> textureMap;
-    if (!textureMap[AssetType::Brick].loadFromFile("assets/tutorial_level/left_grass.png") ||
-        !textureMap[AssetType::Dripstone].loadFromFile("assets/tutorial_level/dripstone.png") ||
-        !textureMap[AssetType::LeftRock].loadFromFile("assets/tutorial_level/left_rock.png") ||
-        !textureMap[AssetType::RightRock].loadFromFile("assets/tutorial_level/right_rock.png") ||
-        !textureMap[AssetType::Tree].loadFromFile("assets/tutorial_level/tree.png") ||
-        !textureMap[AssetType::Grassy].loadFromFile("assets/tutorial_level/grassy.png") ||
-        !textureMap[AssetType::Button].loadFromFile("assets/tutorial_level/button.png") ||
-        !textureMap[AssetType::Stair1].loadFromFile("assets/level2/stair1.png") ||
-        !textureMap[AssetType::Stair2].loadFromFile("assets/level2/stair2.png") ||
-        !textureMap[AssetType::RightStair1].loadFromFile("assets/level2/rightstair1.png") ||
-        !textureMap[AssetType::RightStair2].loadFromFile("assets/level2/rightstair2.png") ||
-        !textureMap[AssetType::Ground].loadFromFile("assets/level2/floor.png") ||
-        !textureMap[AssetType::Ground3].loadFromFile("assets/level3/ground.png") ||
-        !textureMap[AssetType::Platform3].loadFromFile("assets/level3/platform.png") ||
-        !textureMap[AssetType::Brick3].loadFromFile("assets/level3/brick.png") ||
-        !textureMap[AssetType::Statue3].loadFromFile("assets/level3/statue.png")) {
+    std::vector<std::pair<AssetType, const sf::Image*>> atlasImages;
+    for (const AssetInfo& info : ASSET_INFO) {
+        const sf::Image* image = assetLoader.getImage(info.texturePath);
+        if (!image) {
+            std::cerr << "Failed to load textures" << std::endl;
+            return -1;
+        }
+        atlasImages.emplace_back(info.type, image);
+    }
+
+    TextureAtlas atlas;
+    if (!atlas.loadFromImages(atlasImages)) {
         std::cerr << "Failed to load textures" << std::endl;
         return -1;
     }
+    assetLoader.releaseImages();
 
     Background background("assets/tutorial_level/background.png",
                           "assets/tutorial_level/middleground.png",
@@ -214,372 +342,246 @@ int main() {
                                 "assets/level3/town.png",
                                 "assets/tutorial_level/middleground.png", sf::Vector2u(1920, 1080));
 
-    std::vector<std::pair<sf::Vector2f, AssetType>> tilePositions = loadLevel(window, platforms, textureMap, true);
-
-    ButtonInteraction buttonInteraction;
-    SentinelInteraction sentinelInteraction(window, view, player, enemy);
-    sentinelInteraction.setCurrentPlatforms(platforms);
+    GameSession session(atlas);
+    LoadedLevel& level = session.getLevel();
+    LevelBrowser levelBrowser("levels");
+    LevelEditor levelEditor(atlas, gridSize);
 
-    player->setSentinelInteraction(&sentinelInteraction);
+    if (bossFight) session.startBossFight();
+    if (bossFight || inputCapture == InputCapture::Replaying) {
+        gameState = GameState::Play;
+        cursor.hide();
+    }
 
-    bool enemyTriggered = false;
-    bool enemyDescending = false;
-    bool enemySpawned = false;
-    bool proceedToNextLevel = false;
-    int currentLevel = 1;
-    bool sentinelDescendLevel2 = false;
-    bool sentinelDescendLevel3 = false;
-    player->setSpawnPoint(sf::Vector2f(0, 850));
+    float cameraX = session.getView().getCenter().x;
+    float simulationAccumulator = 0.0f;
+    std::size_t replayedFrames = 0;
+    std::uint64_t checksum = GameSession::CHECKSUM_SEED;
 
     while (window.isOpen()) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed || (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)) {
-                window.close();
-            }
+        if (inputCapture == InputCapture::Replaying && replayedFrames < inputRecording.getFrameCount()) {
+            setInputFrame(inputRecording.getFrame(replayedFrames));
+        } else {
+            pollInput();
+        }
 
-            if (gameState == GameState::Title) {
-                enableMouse();
-                titleScreen.handleInput();
-                if (titleScreen.currentSelection == 0 && (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter) || sf::Mouse::isButtonPressed(sf::Mouse::Left))) {
-                    gameState = GameState::Play;
-                    disableMouse();
-                } else if (titleScreen.currentSelection == 2 && (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter) || sf::Mouse::isButtonPressed(sf::Mouse::Left))) {
-                    gameState = GameState::Exit;
+        sf::Event event;
+        {
+            VEX_PROFILE_SCOPE(Events);
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed) {
                     window.close();
                 }
-            }
-
-            if (gameState == GameState::Play) {
-                // Handle editor mode toggle
-                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::E) {
-                    currentMode = (currentMode == GameMode::Play) ? GameMode::Edit : GameMode::Play;
-                    currentMode == GameMode::Edit ? enableMouse() : disableMouse();
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+                    Profiler::get().toggleOverlay();
                 }
-
-                // Handle debug mode toggle
-                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::D && currentMode == GameMode::Edit) {
-                    debugMode = !debugMode;
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+                    if (TraceRecorder::get().isRecording()) TraceRecorder::get().stop(tracePath);
+                    else TraceRecorder::get().start();
                 }
 
-                // Handle save/load
-                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::S) {
-                    saveLevel(window, tilePositions);
+                // The level browser takes all input while it is open
+                if (levelBrowser.isOpen()) {
+                    LevelBrowser::Mode browserMode = levelBrowser.getMode();
+                    if (levelBrowser.handleEvent(event, window)) {
+                        if (browserMode == LevelBrowser::Mode::Save) {
+                            if (saveLevelText(levelBrowser.getSelectedPath(), level.tileMap.toTileList())) {
+                                level.path = levelBrowser.getSelectedPath();
+                                session.getLevelStreamer().invalidate(level.path);
+                            }
+                        } else {
+                            buildLevel(levelBrowser.getSelectedPath(), atlas, level);
+                            levelEditor.attach(level);
+                        }
+                    }
+                    if (!levelBrowser.isOpen()) cursor.setVisible(currentMode == GameMode::Edit);
+                    continue;
                 }
-                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::L) {
-                    tilePositions = loadLevel(window, platforms, textureMap, false);
+
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
+                    window.close();
                 }
 
-                // Handle asset selection based on current level
-                if (currentLevel == 1) {
-                    if (event.key.code == sf::Keyboard::Num1) currentAsset = AssetType::Brick;
-                    if (event.key.code == sf::Keyboard::Num2) currentAsset = AssetType::Dripstone;
-                    if (event.key.code == sf::Keyboard::Num3) currentAsset = AssetType::LeftRock;
-                    if (event.key.code == sf::Keyboard::Num4) currentAsset = AssetType::RightRock;
-                    if (event.key.code == sf::Keyboard::Num6) currentAsset = AssetType::Grassy;
-                } else if (currentLevel == 2) {
-                    if (event.key.code == sf::Keyboard::Num1) currentAsset = AssetType::Stair1;
-                    if (event.key.code == sf::Keyboard::Num2) currentAsset = AssetType::Stair2;
-                    if (event.key.code == sf::Keyboard::Num3) currentAsset = AssetType::RightStair1;
-                    if (event.key.code == sf::Keyboard::Num4) currentAsset = AssetType::RightStair2;
-                    if (event.key.code == sf::Keyboard::Num5) currentAsset = AssetType::Button;
-                    if (event.key.code == sf::Keyboard::Num6) currentAsset = AssetType::Ground;
-                } else if (currentLevel == 3) {
-                    if (event.key.code == sf::Keyboard::Num1) currentAsset = AssetType::Ground3;
-                    if (event.key.code == sf::Keyboard::Num2) currentAsset = AssetType::Platform3;
-                    if (event.key.code == sf::Keyboard::Num3) currentAsset = AssetType::Brick3;
-                    if (event.key.code == sf::Keyboard::Num4) currentAsset = AssetType::Statue3;
-                    if (event.key.code == sf::Keyboard::Num5) currentAsset = AssetType::Button;
+                if (gameState == GameState::Title) {
+                    cursor.show();
+                    titleScreen.handleInput();
+                    if (titleScreen.currentSelection == 0 && (isKeyPressed(sf::Keyboard::Enter) || sf::Mouse::isButtonPressed(sf::Mouse::Left))) {
+                        gameState = GameState::Play;
+                        cursor.hide();
+                    } else if (titleScreen.currentSelection == 2 && (isKeyPressed(sf::Keyboard::Enter) || sf::Mouse::isButtonPressed(sf::Mouse::Left))) {
+                        gameState = GameState::Exit;
+                        window.close();
+                    }
                 }
-            }
 
-            // Handle edit mode tile placement/removal
-            if (currentMode == GameMode::Edit) {
-                sf::Vector2i pixelPos = sf::Mouse::getPosition(window);
-                sf::Vector2f worldPos = window.mapPixelToCoords(pixelPos);
-                sf::Vector2f tilePos(static_cast<float>(static_cast<int>(worldPos.x / gridSize) * gridSize),
-                                  static_cast<float>(static_cast<int>(worldPos.y / gridSize) * gridSize));
-
-                if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
-                    if (std::find_if(tilePositions.begin(), tilePositions.end(),
-                                   [&](const std::pair<sf::Vector2f, AssetType>& tile) { return tile.first == tilePos; }) == tilePositions.end()) {
-                        tilePositions.emplace_back(tilePos, currentAsset);
-                        auto& tileTexture = textureMap[currentAsset];
-                        sf::Vector2f size(tileTexture.getSize().x, tileTexture.getSize().y);
-
-                        if (currentAsset == AssetType::Grassy || currentAsset == AssetType::Ground || currentAsset == AssetType::Ground3) {
-                            platforms.emplace_back(tilePos.x, tilePos.y, size.x, size.y, tileTexture, true);
-                        } else if (currentAsset != AssetType::Tree && currentAsset != AssetType::Button && currentAsset != AssetType::Statue3) {
-                            platforms.emplace_back(tilePos.x, tilePos.y, size.x, size.y, tileTexture, false);
+                if (gameState == GameState::Play) {
+                    // Handle editor mode toggle
+                    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::E) {
+                        currentMode = (currentMode == GameMode::Play) ? GameMode::Edit : GameMode::Play;
+                        session.setEditing(currentMode == GameMode::Edit);
+                        if (currentMode == GameMode::Edit) levelEditor.attach(level);
+                        cursor.setVisible(currentMode == GameMode::Edit);
+                    }
+
+                    // Handle debug mode toggle
+                    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::D && currentMode == GameMode::Edit) {
+                        debugMode = !debugMode;
+                        if (debugMode) {
+                            ResourceCache::get().printReport(std::cout);
+                            std::cout << "Tile map: " << level.tileMap.getTileCount() << " tiles in "
+                                      << level.tileMap.getChunkCount() << " chunks, "
+                                      << level.tileMap.getMemoryBytes() / 1024 << " KiB\n";
                         }
                     }
-                }
 
-                if (sf::Mouse::isButtonPressed(sf::Mouse::Right)) {
-                    auto tileIt = std::find_if(tilePositions.begin(), tilePositions.end(),
-                                           [&](const std::pair<sf::Vector2f, AssetType>& tile) {
-                                               return tile.first == tilePos;
-                                           });
-                    if (tileIt != tilePositions.end()) {
-                        tilePositions.erase(tileIt);
-
-                        auto platformIt = std::find_if(platforms.begin(), platforms.end(),
-                                                   [&](const Platform& platform) {
-                                                       const auto& tiles = platform.getTiles();
-                                                       for (const auto& tile : tiles) {
-                                                           if (tile.getPosition() == tilePos) {
-                                                               return true;
-                                                           }
-                                                       }
-                                                       return false;
-                                                   });
-                        if (platformIt != platforms.end()) {
-                            platforms.erase(platformIt);
+                    // Handle save/load. Opened on release so the key's own text event
+                    // doesn't land in the browser's file name field.
+                    if (event.type == sf::Event::KeyReleased && event.key.code == sf::Keyboard::S) {
+                        levelBrowser.openSave(level.path);
+                        cursor.show();
+                    }
+                    if (event.type == sf::Event::KeyReleased && event.key.code == sf::Keyboard::L) {
+                        levelBrowser.openLoad();
+                        cursor.show();
+                    }
+
+                    // Handle asset selection from the current level's palette
+                    if (event.type == sf::Event::KeyPressed) {
+                        for (const AssetInfo& info : ASSET_INFO) {
+                            if (info.paletteKey != 0 && (info.paletteLevels & levelBit(session.getCurrentLevel())) &&
+                                event.key.code == sf::Keyboard::Num0 + info.paletteKey) {
+                                currentAsset = info.type;
+                            }
                         }
                     }
                 }
+
+                // Handle edit mode tile placement/removal
+                if (currentMode == GameMode::Edit) {
+                    levelEditor.handleEvent(event, window, currentAsset);
+                    levelEditor.update(window, currentAsset);
+                }
             }
         }
 
         float deltaTime = clock.restart().asSeconds();
 
+        // A recording or replay covers one uninterrupted stretch of play
+        if ((inputCapture == InputCapture::Recording || inputCapture == InputCapture::Replaying) &&
+            (gameState != GameState::Play || currentMode == GameMode::Edit || levelBrowser.isOpen() ||
+             (inputCapture == InputCapture::Replaying && replayedFrames == inputRecording.getFrameCount()))) {
+            finishInputCapture(inputCapture, inputRecording, recordingPath, replayedFrames, checksum);
+        }
+
         if (gameState == GameState::Title) {
             titleScreen.handleInput();
             titleScreen.update(deltaTime);
             titleScreen.render();
         } else if (gameState == GameState::Victory) {
             window.clear();
-            
+            window.setView(window.getDefaultView());
+
             // Update and draw the victory screen
-            sentinelInteraction.updateVictoryScreen(deltaTime);
-            sentinelInteraction.drawVictoryScreen(window);
-            
+            session.getSentinelInteraction().updateVictoryScreen(deltaTime);
+            session.getSentinelInteraction().drawVictoryScreen(window);
+
             // Handle victory screen input
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter) || 
-                sf::Keyboard::isKeyPressed(sf::Keyboard::Space) || 
+            if (isKeyPressed(sf::Keyboard::Enter) ||
+                isKeyPressed(sf::Keyboard::Space) ||
                 sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
-                // Return to title screen
+                // Return to title screen, with the story back at level 1
                 gameState = GameState::Title;
-                
-                // Reset game state
-                currentLevel = 1;
-                proceedToNextLevel = false;
-                enemyTriggered = false;
-                enemySpawned = false;
-                sentinelInteraction.resetState();
-                
-                // Reset player and enemy positions
-                player->setPosition(0, 850);
-                player->setSpawnPoint(sf::Vector2f(0, 850));
-                player->resetState();
-                player->resetHealth();
-                enemy->setPosition(1600, -500);
-                
-                // Load initial level
-                tilePositions = loadLevelFromFile("levels/level1.txt", platforms, textureMap);
-                
-                // Update view and other necessary resets
-                updateView(window, view);
-                text.setString("");
-                buttonInteraction.resetPrompt();
+                session.restart();
+            }
+
+            Profiler::get().drawOverlay(window, *font);
+            {
+                VEX_PROFILE_SCOPE(Display);
+                window.display();
             }
-            
-            window.display();
         } else if (gameState == GameState::Play) {
-            window.clear();
-            float playerX = player->getGlobalBounds().left;
+            if (inputCapture == InputCapture::Waiting && currentMode == GameMode::Play && !levelBrowser.isOpen()) {
+                inputRecording.clear();
+                inputRecording.setStartsAtBossFight(bossFight);
+                inputRecording.setSeed(RandomService::get().getSeed());
+                inputCapture = InputCapture::Recording;
+            }
 
-            // Render appropriate background based on current level
-            if (currentLevel == 1) {
-                background.render(window, sf::Vector2u(1920, 1080), playerX, deltaTime);
-            } else if (currentLevel == 2) {
-                nextLevelBackground.render(window, sf::Vector2u(1920, 1080), playerX, deltaTime);
-                
-                if (sentinelDescendLevel2) {
-                    float targetYPosition = 200.0f;
-                    float descentSpeed = 500.0f;
-                    if (enemy->getPosition().y < targetYPosition) {
-                        enemy->setPosition(100, enemy->getPosition().y + descentSpeed * deltaTime);
-                    } else {
-                        enemy->setPosition(100, targetYPosition);
-                        sentinelDescendLevel2 = false;
-                        enemyTriggered = true;
-                        sentinelInteraction.startLevel2Interaction();
-                    }
+            float interpolation = 0.0f;
+            if (inputCapture == InputCapture::Recording || inputCapture == InputCapture::Replaying) {
+                if (inputCapture == InputCapture::Recording) inputRecording.append(getInputFrame());
+                else ++replayedFrames;
+                advanceRecordedFrame(session);
+                checksum = session.getChecksum(checksum);
+                simulationAccumulator = 0.0f;
+            } else {
+                // Gameplay is paused while the level browser is up
+                if (!levelBrowser.isOpen()) simulationAccumulator += deltaTime;
+                int simulationSteps = 0;
+                while (simulationAccumulator >= SIMULATION_STEP && simulationSteps < MAX_SIMULATION_STEPS_PER_FRAME) {
+                    session.step(SIMULATION_STEP);
+                    simulationAccumulator -= SIMULATION_STEP;
+                    ++simulationSteps;
                 }
-             } else if (currentLevel == 3) {
-    level3Background.render(window, sf::Vector2u(1920, 1080), playerX, deltaTime);
-
-    // Check for victory first, before any other level 3 logic
-    if (sentinelInteraction.isVictorious()) {
-        gameState = GameState::Victory;
-        enableMouse();
-    }
-
-    if (sentinelDescendLevel3) {
-        float targetYPosition = 200.0f;
-        float descentSpeed = 500.0f;
-        if (enemy->getPosition().y < targetYPosition) {
-            enemy->setPosition(600, enemy->getPosition().y + descentSpeed * deltaTime);
-        } else {
-            enemy->setPosition(600, targetYPosition);
-            sentinelDescendLevel3 = false;
-            enemyTriggered = true;
-            sentinelInteraction.startLevel3Interaction();
-        }
-    }
-
-    // Draw background elements first
-    for (const auto& tileData : tilePositions) {
-        auto it = textureMap.find(tileData.second);
-        if (it != textureMap.end()) {
-            sf::Sprite tile(it->second);
-            tile.setPosition(tileData.first);
-            window.draw(tile);
-        }
-    }
-
-    // Update and draw boss fight elements
-    if (enemyTriggered) {
-        if (sentinelInteraction.isInBossFight()) {
-            // Update boss fight logic
-            sentinelInteraction.updateBossFight(deltaTime, enemy, player->getPosition());
-            sentinelInteraction.checkGemCollision(player->getPosition());
-
-            // Check orb collisions with player
-            if (!player->isInvulnerable() && !player->isPlayerDead()) {
-                sf::FloatRect playerBounds = player->getGlobalBounds();
-                for (const auto& orb : sentinelInteraction.getOrbs()) {
-                    if (playerBounds.intersects(orb.getGlobalBounds())) {
-                        player->takeDamage();
-                        break;
-                    }
+                if (simulationSteps == MAX_SIMULATION_STEPS_PER_FRAME && simulationAccumulator >= SIMULATION_STEP) {
+                    simulationAccumulator = std::fmod(simulationAccumulator, SIMULATION_STEP);
                 }
-            }
-        }
+                // How far the display is between the last two simulation steps
+                interpolation = simulationAccumulator / SIMULATION_STEP;
 
-        // Regular sentinel interaction
-        sentinelInteraction.triggerInteractionLevel3(window, text, enemyTriggered, 
-                                                   enemyDescending, enemySpawned, 
-                                                   enemy, deltaTime, player->getPosition(), 
-                                                   buttonInteraction, proceedToNextLevel);
-        window.draw(text);
-    }
-}            
-
-            // Draw tiles for levels 1 and 2
-            if (currentLevel != 3) {
-                for (const auto& tileData : tilePositions) {
-                    auto it = textureMap.find(tileData.second);
-                    if (it != textureMap.end()) {
-                        sf::Sprite tile(it->second);
-                        tile.setPosition(tileData.first);
-                        window.draw(tile);
-                    }
-                }
+                session.update(deltaTime);
             }
-
-            if (currentLevel == 1) {
-                sentinelInteraction.triggerInteraction(window, text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, player->getPosition(), buttonInteraction, proceedToNextLevel);
-                window.draw(text);
-            } else if (currentLevel == 2) {
-                if (enemyTriggered) {
-                    sentinelInteraction.triggerInteractionLevel2(window, text, enemyTriggered, enemyDescending, enemySpawned, enemy, deltaTime, player->getPosition(), buttonInteraction, proceedToNextLevel);
-                    window.draw(text);
-                }
+            if (session.isVictorious()) {
+                gameState = GameState::Victory;
+                cursor.show();
             }
 
+            // Follow the player, or pan with the arrow keys while editing
             if (currentMode == GameMode::Play) {
-                if (playerJustReset) playerJustReset = false;
-                else player->update(deltaTime, platforms, window.getSize().x, window.getSize().y, *enemy);
-
-                if (!sentinelInteraction.isAscending()) {
-                    if (!sentinelInteraction.isInBossFight() || currentLevel != 3) {
-                        enemy->update(deltaTime, platforms, window.getSize().x, window.getSize().y);
-                    }
-                }
-
-                player->draw(window);
-                enemy->draw(window);
-
-                // Draw boss fight UI elements on top if in level 3 boss fight
-                if (currentLevel == 3 && sentinelInteraction.isInBossFight()) {
-                    sentinelInteraction.drawBossFightElements(window);
+                cameraX = session.getPlayerFocusX(interpolation);
+            } else if (!levelBrowser.isOpen()) {
+                if (isKeyPressed(sf::Keyboard::Left)) cameraX -= CAMERA_PAN_SPEED * deltaTime;
+                if (isKeyPressed(sf::Keyboard::Right)) cameraX += CAMERA_PAN_SPEED * deltaTime;
+            }
+            session.moveCamera(cameraX);
+            const sf::View& view = session.getView();
+            cameraX = view.getCenter().x;
+            level.tileLayer.updateResidency(level.tileMap, getVisibleArea(view));
 
-                    if (sentinelInteraction.isVictorious()) {
-                        gameState = GameState::Victory;
-                        enableMouse(); // Allow mouse for victory screen interaction
-                    }
-                }
+            window.clear();
+            float playerX = session.getPlayer().getGlobalBounds().left;
 
-                if (currentLevel == 1) {
-                    buttonInteraction.handleInteraction(player->getPosition(), tilePositions, window, enemyTriggered, enemyDescending, enemySpawned);
-                } else if (currentLevel == 2) {
-                    buttonInteraction.handleInteractionLevel2(player->getPosition(), tilePositions, 
-                                                          window, enemyTriggered, enemyDescending, 
-                                                          sentinelDescendLevel2);
-                } else if (currentLevel == 3) {
-                    buttonInteraction.handleInteractionLevel3(player->getPosition(), tilePositions, 
-                                                          window, enemyTriggered, enemyDescending, 
-                                                          sentinelDescendLevel3);
-                }
+            // Backgrounds are screen-sized, so they're drawn with the default view
+            window.setView(window.getDefaultView());
+            if (session.getCurrentLevel() == 1) {
+                background.render(window, sf::Vector2u(1920, 1080), playerX, deltaTime);
+            } else if (session.getCurrentLevel() == 2) {
+                nextLevelBackground.render(window, sf::Vector2u(1920, 1080), playerX, deltaTime);
+            } else if (session.getCurrentLevel() == 3) {
+                level3Background.render(window, sf::Vector2u(1920, 1080), playerX, deltaTime);
             }
 
+            session.draw(window, interpolation);
+
             if (currentMode == GameMode::Edit && debugMode) {
-                drawGrid(window, view.getSize(), gridSize);
+                drawGrid(window, view, gridSize);
             }
-
-            if (proceedToNextLevel && player->getPosition().x >= window.getSize().x - 75) {
-                proceedToNextLevel = false;
-                if (currentLevel == 1) {
-                    currentLevel = 2;
-                    tilePositions.clear();
-                    platforms.clear();
-                    
-                    tilePositions = loadLevelFromFile("levels/level2.txt", platforms, textureMap);
-
-                    enemy->setPosition(100, -500);
-                    player->setPosition(0, 850);
-                    player->setSpawnPoint(sf::Vector2f(0, 850));
-                    player->resetState();
-                    player->resetHealth();
-                    enemy->flipSprite();
-                    updateView(window, view);
-                    enemyTriggered = false;
-                    enemySpawned = false;
-                    sentinelInteraction.resetState();
-                    text.setString("");
-                    buttonInteraction.resetPrompt();
-                    playerJustReset = true;
-                    sentinelDescendLevel2 = false;
-                } else if (currentLevel == 2) {
-                    currentLevel = 3;
-                    tilePositions.clear();
-                    platforms.clear();
-
-                    tilePositions = loadLevelFromFile("levels/level3.txt", platforms, textureMap);
-                    sentinelInteraction.setCurrentPlatforms(platforms);
-
-                    enemy->setPosition(960, -500);
-                    enemy->flipSprite();
-                    player->setPosition(0, 850);
-                    player->setSpawnPoint(sf::Vector2f(0, 850));
-                    player->resetState();
-                    player->resetHealth();
-                    updateView(window, view);
-                    enemyTriggered = false;
-                    enemySpawned = false;
-                    sentinelInteraction.resetState();
-                    text.setString("");
-                    buttonInteraction.resetPrompt();
-                    playerJustReset = true;
-                    sentinelDescendLevel3 = false;
-                }
+            if (currentMode == GameMode::Edit && !levelBrowser.isOpen()) {
+                levelEditor.drawCursor(window);
             }
 
-            window.display();
+            levelBrowser.draw(window);
+            Profiler::get().drawOverlay(window, *font);
+            {
+                VEX_PROFILE_SCOPE(Display);
+                window.display();
+            }
         }
+
+        VEX_PROFILE_FRAME();
     }
 
+    finishInputCapture(inputCapture, inputRecording, recordingPath, replayedFrames, checksum);
+    if (TraceRecorder::get().isRecording()) TraceRecorder::get().stop(tracePath);
     return 0;
 }
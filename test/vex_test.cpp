@@ -0,0 +1,332 @@
+// vex_test.cpp
+//
+// Unit tests for vex_core: collision box merging, the tile map, both level
+// formats and input recordings. Each test prints the checks that fail; the exit
+// status is non-zero if any did. Files are written to the temp directory only,
+// so it runs from anywhere (ctest runs it from the build directory).
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../include/AssetType.hpp"
+#include "../include/CollisionGrid.hpp"
+#include "../include/InputRecording.hpp"
+#include "../include/LevelIO.hpp"
+#include "../include/TileMap.hpp"
+
+namespace {
+
+using TileList = std::vector<std::pair<sf::Vector2f, AssetType>>;
+
+int checkCount = 0;
+int failureCount = 0;
+
+void check(bool passed, const char* expression, const char* file, int line) {
+    ++checkCount;
+    if (passed) return;
+    ++failureCount;
+    std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+}
+
+#define CHECK(...) check((__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("vex_test_" + name)).string();
+}
+
+std::vector<sf::FloatRect> sortedBoxes(std::vector<sf::FloatRect> boxes) {
+    std::sort(boxes.begin(), boxes.end(), [](const sf::FloatRect& a, const sf::FloatRect& b) {
+        return std::tie(a.top, a.left, a.width, a.height) < std::tie(b.top, b.left, b.width, b.height);
+    });
+    return boxes;
+}
+
+TileList sortedTiles(TileList tiles) {
+    std::sort(tiles.begin(), tiles.end(), [](const TileList::value_type& a, const TileList::value_type& b) {
+        return std::make_tuple(a.first.y, a.first.x, static_cast<int>(a.second)) <
+               std::make_tuple(b.first.y, b.first.x, static_cast<int>(b.second));
+    });
+    return tiles;
+}
+
+// Full, half-height (like Platform3) and off-grid tiles, including one stacked
+// on an occupied cell and some left of and above the origin
+TileList makeTestLevel() {
+    return {
+        {sf::Vector2f(0, 0), AssetType::Brick},
+        {sf::Vector2f(64, 0), AssetType::Brick},
+        {sf::Vector2f(128, 0), AssetType::Brick},
+        {sf::Vector2f(0, 64), AssetType::Brick},
+        {sf::Vector2f(-64, -128), AssetType::Ground3},
+        {sf::Vector2f(2048, 640), AssetType::Platform3},
+        {sf::Vector2f(64, 0), AssetType::Tree},
+        {sf::Vector2f(10, 300), AssetType::Button},
+    };
+}
+
+void testMergeBoxes() {
+    // A row of three touching tiles becomes one box
+    std::vector<sf::FloatRect> row = {{128, 0, 64, 64}, {0, 0, 64, 64}, {64, 0, 64, 64}};
+    CHECK(sortedBoxes(CollisionGrid::mergeBoxes(row)) == std::vector<sf::FloatRect>{{0, 0, 192, 64}});
+
+    // A 2x2 block merges along rows, then the equal-width rows stack
+    std::vector<sf::FloatRect> block = {{0, 0, 64, 64}, {64, 0, 64, 64}, {0, 64, 64, 64}, {64, 64, 64, 64}};
+    CHECK(sortedBoxes(CollisionGrid::mergeBoxes(block)) == std::vector<sf::FloatRect>{{0, 0, 128, 128}});
+
+    // Rows of different widths don't stack
+    std::vector<sf::FloatRect> lShape = {{0, 0, 64, 64}, {64, 0, 64, 64}, {0, 64, 64, 64}};
+    CHECK(sortedBoxes(CollisionGrid::mergeBoxes(lShape)) ==
+          sortedBoxes({{0, 0, 128, 64}, {0, 64, 64, 64}}));
+
+    // Gaps and different heights stay separate
+    std::vector<sf::FloatRect> apart = {{0, 0, 64, 64}, {128, 0, 64, 64}, {192, 0, 64, 32}};
+    CHECK(sortedBoxes(CollisionGrid::mergeBoxes(apart)) == sortedBoxes(apart));
+
+    // Overlapping boxes in a row merge into their union
+    std::vector<sf::FloatRect> overlapping = {{0, 0, 100, 64}, {50, 0, 100, 64}};
+    CHECK(sortedBoxes(CollisionGrid::mergeBoxes(overlapping)) == std::vector<sf::FloatRect>{{0, 0, 150, 64}});
+
+    CHECK(CollisionGrid::mergeBoxes({}).empty());
+}
+
+// Boxes on both sides of the origin, so cell keys cover negative coordinates
+void testCollisionGridQuery() {
+    CollisionGrid grid;
+    grid.build({{-192, -64, 128, 64}, {-64, 0, 64, 64}, {64, 64, 64, 64}});
+
+    auto hits = [&grid](const sf::FloatRect& area) {
+        std::vector<sf::FloatRect> found;
+        grid.query(area, [&found](const sf::FloatRect& box) { found.push_back(box); });
+        return sortedBoxes(found);
+    };
+    CHECK(hits({-180, -60, 10, 10}) == std::vector<sf::FloatRect>{{-192, -64, 128, 64}});
+    CHECK(hits({-100, -32, 64, 64}) == sortedBoxes({{-192, -64, 128, 64}, {-64, 0, 64, 64}}));
+    CHECK(hits({-1000, -1000, 2000, 2000}).size() == 3);
+    CHECK(hits({200, -200, 64, 64}).empty());
+
+    CHECK(grid.extract({-160, -40, 4, 4}) == std::vector<sf::FloatRect>{{-192, -64, 128, 64}});
+    CHECK(hits({-180, -60, 10, 10}).empty());
+    grid.insert({-192, -64, 64, 64});
+    CHECK(hits({-180, -60, 10, 10}) == std::vector<sf::FloatRect>{{-192, -64, 64, 64}});
+}
+
+void testTileMap() {
+    TileList tiles = makeTestLevel();
+    TileMap tileMap;
+    tileMap.build(tiles);
+
+    // The stacked tree and the off-grid button become props; nothing is lost
+    CHECK(tileMap.getTileCount() == tiles.size());
+    CHECK(tileMap.getProps().size() == 2);
+    CHECK(sortedTiles(tileMap.toTileList()) == sortedTiles(tiles));
+    CHECK(tileMap.get(1, 0) == static_cast<TileMap::TileId>(AssetType::Brick));
+    CHECK(tileMap.get(-1, -2) == static_cast<TileMap::TileId>(AssetType::Ground3));
+    CHECK(tileMap.get(5, 5) == TileMap::EMPTY);
+
+    // set/erase report whether they changed anything
+    CHECK(tileMap.set(5, 5, AssetType::Grassy));
+    CHECK(!tileMap.set(5, 5, AssetType::Grassy));
+    CHECK(tileMap.set(5, 5, AssetType::Brick3));
+    CHECK(tileMap.get(5, 5) == static_cast<TileMap::TileId>(AssetType::Brick3));
+    CHECK(tileMap.erase(5, 5));
+    CHECK(!tileMap.erase(5, 5));
+    CHECK(!tileMap.erase(40, 40));
+
+    // Across a chunk boundary on the negative side
+    CHECK(tileMap.set(-TileMap::CHUNK_CELLS, -1, AssetType::Stair1));
+    CHECK(tileMap.set(-1, -1, AssetType::Stair2));
+    CHECK(tileMap.erase(0, 1));
+    tiles.emplace_back(sf::Vector2f(-TileMap::CHUNK_CELLS * 64.0f, -64), AssetType::Stair1);
+    tiles.emplace_back(sf::Vector2f(-64, -64), AssetType::Stair2);
+    tiles.erase(std::find_if(tiles.begin(), tiles.end(), [](const TileList::value_type& tile) {
+        return tile.first == sf::Vector2f(0, 64);
+    }));
+
+    // Grid edits leave the props alone, and the list form round-trips
+    CHECK(tileMap.getProps().size() == 2);
+    CHECK(sortedTiles(tileMap.toTileList()) == sortedTiles(tiles));
+
+    TileMap rebuilt;
+    rebuilt.build(tileMap.toTileList());
+    CHECK(sortedTiles(rebuilt.toTileList()) == sortedTiles(tiles));
+    CHECK(rebuilt.getProps().size() == 2);
+}
+
+std::vector<sf::Vector2f> testAssetSizes() {
+    std::vector<sf::Vector2f> assetSizes(ASSET_TYPE_COUNT + 1, sf::Vector2f(64, 64));
+    assetSizes[static_cast<std::size_t>(AssetType::Platform3)] = sf::Vector2f(64, 32);
+    return assetSizes;
+}
+
+void testLevelRoundTrip() {
+    TileList tiles = makeTestLevel();
+    std::string textPath = tempPath("level.txt");
+    std::string binaryPath = tempPath("level.vexl");
+    std::filesystem::remove(binaryPath);
+
+    // Text
+    CHECK(saveLevelText(textPath, tiles));
+    TileList textTiles;
+    CHECK(loadLevelText(textPath, textTiles));
+    CHECK(textTiles == tiles);
+
+    // Without a .vexl next to it, loadLevelData parses the text and merges the boxes
+    LevelData fromText;
+    CHECK(loadLevelData(textPath, fromText, testAssetSizes()));
+    CHECK(fromText.tiles == tiles);
+    CHECK(sortedBoxes(fromText.collisionBoxes) == sortedBoxes(buildCollisionBoxes(tiles, testAssetSizes())));
+
+    // Binary, with the boxes built from the text
+    CHECK(saveLevelBinary(binaryPath, fromText));
+    LevelData fromBinary;
+    CHECK(loadLevelBinary(binaryPath, fromBinary));
+    CHECK(fromBinary.tiles == fromText.tiles);
+    CHECK(fromBinary.collisionBoxes == fromText.collisionBoxes);
+
+    // The (newer) .vexl is now preferred, and loads the same level
+    LevelData preferred;
+    CHECK(getBinaryLevelPath(textPath) == binaryPath);
+    CHECK(loadLevelData(textPath, preferred, {}));
+    CHECK(preferred.tiles == tiles);
+    CHECK(preferred.collisionBoxes == fromText.collisionBoxes);
+
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(binaryPath);
+}
+
+std::vector<char> readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(bytes.data(), bytes.size());
+}
+
+void setU32(std::vector<char>& bytes, std::size_t offset, std::uint32_t value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+// Header fields whose sections don't fit in the file must be rejected before
+// anything is read from the mapping
+void testLevelRejectsBadSections() {
+    LevelData level;
+    level.tiles = makeTestLevel();
+    level.collisionBoxes = buildCollisionBoxes(level.tiles, testAssetSizes());
+
+    std::string validPath = tempPath("valid.vexl");
+    std::string badPath = tempPath("bad.vexl");
+    CHECK(saveLevelBinary(validPath, level));
+    const std::vector<char> valid = readFile(validPath);
+    CHECK(valid.size() == 24 + level.tiles.size() * 12 + level.collisionBoxes.size() * 16);
+
+    LevelData loaded;
+    std::vector<char> bytes = valid;
+    bytes.resize(bytes.size() - 4);  // last box cut short
+    writeFile(badPath, bytes);
+    CHECK(!loadLevelBinary(badPath, loaded));
+
+    bytes = valid;
+    setU32(bytes, 8, 0x10000000);  // tileCount far past the end of the file
+    writeFile(badPath, bytes);
+    CHECK(!loadLevelBinary(badPath, loaded));
+
+    bytes = valid;
+    setU32(bytes, 20, static_cast<std::uint32_t>(valid.size()) + 64);  // box offset past the end
+    writeFile(badPath, bytes);
+    CHECK(!loadLevelBinary(badPath, loaded));
+
+    bytes = valid;
+    setU32(bytes, 16, 26);  // misaligned tile offset
+    writeFile(badPath, bytes);
+    CHECK(!loadLevelBinary(badPath, loaded));
+
+    bytes = valid;
+    setU32(bytes, 4, LEVEL_FILE_VERSION + 1);
+    writeFile(badPath, bytes);
+    CHECK(!loadLevelBinary(badPath, loaded));
+
+    // The unmodified file still loads
+    CHECK(loadLevelBinary(validPath, loaded));
+    CHECK(loaded.tiles == level.tiles);
+
+    std::filesystem::remove(validPath);
+    std::filesystem::remove(badPath);
+}
+
+void testInputRecordingRoundTrip() {
+    const InputFrame left = 1u << 0, jump = 1u << 4;
+    InputRecording recording;
+    for (int i = 0; i < 300; ++i) recording.append(0);
+    for (int i = 0; i < 50; ++i) recording.append(left);
+    recording.append(left | jump);
+    for (int i = 0; i < 50; ++i) recording.append(left);
+    recording.append(0);
+    recording.setStartsAtBossFight(true);
+    recording.setChecksum(0x0123456789abcdefull);
+    recording.setSeed(0xfedcba9876543210ull);
+
+    std::string path = tempPath("input.vexr");
+    CHECK(recording.saveToFile(path));
+    // Five runs after the 40-byte header
+    CHECK(readFile(path).size() == 40 + 5 * 8);
+
+    InputRecording loaded;
+    CHECK(loaded.loadFromFile(path));
+    CHECK(loaded.getFrameCount() == recording.getFrameCount());
+    bool framesMatch = loaded.getFrameCount() == recording.getFrameCount();
+    for (std::size_t i = 0; framesMatch && i < recording.getFrameCount(); ++i) {
+        framesMatch = loaded.getFrame(i) == recording.getFrame(i);
+    }
+    CHECK(framesMatch);
+    CHECK(loaded.startsAtBossFight());
+    CHECK(loaded.getChecksum() == recording.getChecksum());
+    CHECK(loaded.getSeed() == recording.getSeed());
+
+    // Counts that don't match the runs are rejected before anything is allocated
+    const std::vector<char> valid = readFile(path);
+    std::vector<char> bytes = valid;
+    setU32(bytes, 16, 0x40000000);  // runCount far past the end of the file
+    writeFile(path, bytes);
+    CHECK(!loaded.loadFromFile(path));
+
+    bytes = valid;
+    setU32(bytes, 12, 0xffffffff);  // frameCount the runs don't add up to
+    writeFile(path, bytes);
+    CHECK(!loaded.loadFromFile(path));
+    CHECK(loaded.getFrameCount() == 0);
+
+    bytes = valid;
+    bytes.resize(bytes.size() - 8);  // last run missing
+    writeFile(path, bytes);
+    CHECK(!loaded.loadFromFile(path));
+
+    // Not a recording at all
+    writeFile(path, std::vector<char>(64, 'x'));
+    CHECK(!loaded.loadFromFile(path));
+
+    std::filesystem::remove(path);
+}
+
+} // namespace
+
+int main() {
+    testMergeBoxes();
+    testCollisionGridQuery();
+    testTileMap();
+    testLevelRoundTrip();
+    testLevelRejectsBadSections();
+    testInputRecordingRoundTrip();
+
+    std::cout << checkCount - failureCount << "/" << checkCount << " checks passed" << std::endl;
+    return failureCount == 0 ? 0 : 1;
+}
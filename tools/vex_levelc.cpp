@@ -0,0 +1,74 @@
+// vex_levelc.cpp
+//
+// Level converter: turns editor text levels into the binary .vexl format the
+// game maps at load time. Run from the repository root so the asset paths
+// resolve, e.g.
+//
+//   ./build/vex_levelc levels/*.txt
+//
+// Each input is written next to itself with a .vexl extension, or to -o <path>
+// when converting a single file.
+
+#include <SFML/Graphics.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../include/AssetType.hpp"
+#include "../include/LevelIO.hpp"
+
+namespace {
+
+// Tile sizes straight from the image headers; sf::Image doesn't need a GL context.
+bool loadAssetSizes(std::vector<sf::Vector2f>& assetSizes) {
+    assetSizes.assign(ASSET_TYPE_COUNT + 1, sf::Vector2f());
+    for (const AssetInfo& info : ASSET_INFO) {
+        sf::Image image;
+        if (!image.loadFromFile(info.texturePath)) {
+            std::cerr << "Error loading " << info.texturePath << std::endl;
+            return false;
+        }
+        assetSizes[static_cast<std::size_t>(info.type)] = sf::Vector2f(static_cast<float>(image.getSize().x), static_cast<float>(image.getSize().y));
+    }
+    return true;
+}
+
+bool convertLevel(const std::string& inputPath, const std::string& outputPath, const std::vector<sf::Vector2f>& assetSizes) {
+    LevelData level;
+    if (!loadLevelText(inputPath, level.tiles)) return false;
+    level.collisionBoxes = buildCollisionBoxes(level.tiles, assetSizes);
+
+    if (!saveLevelBinary(outputPath, level)) return false;
+    std::cout << inputPath << " -> " << outputPath << " (" << level.tiles.size() << " tiles, "
+              << level.collisionBoxes.size() << " collision boxes)" << std::endl;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> inputs;
+    std::string outputPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty() || (!outputPath.empty() && inputs.size() != 1)) {
+        std::cerr << "Usage: vex_levelc <level.txt>... | vex_levelc <level.txt> -o <level.vexl>" << std::endl;
+        return 1;
+    }
+
+    std::vector<sf::Vector2f> assetSizes;
+    if (!loadAssetSizes(assetSizes)) return 1;
+
+    int failures = 0;
+    for (const auto& input : inputs) {
+        std::string output = outputPath.empty() ? getBinaryLevelPath(input) : outputPath;
+        if (!convertLevel(input, output, assetSizes)) ++failures;
+    }
+    return failures == 0 ? 0 : 1;
+}